@@ -30,6 +30,13 @@
 #define	MB_CONTOUR_OLD	0
 #define	MB_CONTOUR_TRIANGLES	1
 
+/* topography grid defines - grids larger than MB_TOPOGRID_LOAD_MAX nodes
+	are read in square tiles of MB_TOPOGRID_TILE_DIM nodes on demand,
+	holding at most MB_TOPOGRID_NTILE tiles in memory */
+#define	MB_TOPOGRID_LOAD_MAX	16777216
+#define	MB_TOPOGRID_TILE_DIM	256
+#define	MB_TOPOGRID_NTILE	16
+
 /* swath bathymetry data structure */
 struct	ping
 	{
@@ -162,6 +169,15 @@ struct mb_topogrid_struct
 	double	dx;
 	double	dy;
 	float	*data;
+
+	/* tile cache used instead of data for large grids */
+	int	tiled;
+	int	ntile_x;
+	int	ntile_y;
+	int	tile_clock;
+	int	tile_id[MB_TOPOGRID_NTILE];
+	int	tile_use[MB_TOPOGRID_NTILE];
+	float	*tile_data[MB_TOPOGRID_NTILE];
 	};
 
 /* mb_contour and mb_track function prototypes */
@@ -289,6 +305,29 @@ int mb_read_gmt_grd(int verbose, char *grdfile,
 			float	**data_dzdx,
 			float	**data_dzdy,
 			int	*error);
+int mb_read_gmt_grd_header(int verbose, char *grdfile,
+			int	*grid_projection_mode,
+			char	*grid_projection_id,
+			float	*nodatavalue,
+			int	*nx,
+			int	*ny,
+			double	*min,
+			double	*max,
+			double	*xmin,
+			double	*xmax,
+			double	*ymin,
+			double	*ymax,
+			double	*dx,
+			double	*dy,
+			int	*error);
+int mb_read_gmt_grd_window(int verbose, char *grdfile,
+			int	i0,
+			int	j0,
+			int	nx_window,
+			int	ny_window,
+			float	nodatavalue,
+			float	*data,
+			int	*error);
 int mb_write_gmt_grd(int verbose,
 			char *grdfile,
 			float *grid,
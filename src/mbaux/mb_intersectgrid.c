@@ -40,6 +40,8 @@
 
 static char rcs_id[] = "$Id: mb_intersectgrid.c 1917 2012-01-10 19:25:33Z caress $";
 
+static float mb_topogrid_node(int verbose, struct mb_topogrid_struct *topogrid, int i, int j);
+
 /*--------------------------------------------------------------------*/
 int mb_topogrid_init(int verbose, mb_path topogridfile, int *lonflip,
 			void **topogrid_ptr, int *error)
@@ -47,6 +49,7 @@ int mb_topogrid_init(int verbose, mb_path topogridfile, int *lonflip,
 	char	*function_name = "mb_topogrid_init";
 	int	status = MB_SUCCESS;
 	struct mb_topogrid_struct *topogrid;
+	int	i;
 
 	/* print input debug statements */
 	if (verbose >= 2)
@@ -66,16 +69,47 @@ int mb_topogrid_init(int verbose, mb_path topogridfile, int *lonflip,
 	/* get pointer to topogrid structure */
 	topogrid = (struct mb_topogrid_struct *) *topogrid_ptr;
 
-	/* read in the data */
+	/* read the grid header to decide whether to load the whole grid */
 	strcpy(topogrid->file, topogridfile);
 	topogrid->data = NULL;
-	status = mb_read_gmt_grd(verbose, topogrid->file, &topogrid->projection_mode, topogrid->projection_id, &topogrid->nodatavalue,
+	topogrid->nxy = 0;
+	topogrid->tiled = MB_NO;
+	topogrid->ntile_x = 0;
+	topogrid->ntile_y = 0;
+	topogrid->tile_clock = 0;
+	for (i=0;i<MB_TOPOGRID_NTILE;i++)
+		{
+		topogrid->tile_id[i] = -1;
+		topogrid->tile_use[i] = 0;
+		topogrid->tile_data[i] = NULL;
+		}
+	status = mb_read_gmt_grd_header(verbose, topogrid->file, &topogrid->projection_mode, topogrid->projection_id,
+				&topogrid->nodatavalue, &topogrid->nx, &topogrid->ny, &topogrid->min, &topogrid->max,
+				&topogrid->xmin, &topogrid->xmax, &topogrid->ymin, &topogrid->ymax,
+				&topogrid->dx, &topogrid->dy, error);
+
+	/* large grids are read in tiles as needed, others are read in whole */
+	if (status == MB_SUCCESS
+		&& (double)topogrid->nx * (double)topogrid->ny > MB_TOPOGRID_LOAD_MAX)
+		{
+		topogrid->tiled = MB_YES;
+		topogrid->nxy = 0;
+		topogrid->ntile_x = (topogrid->nx - 1) / MB_TOPOGRID_TILE_DIM + 1;
+		topogrid->ntile_y = (topogrid->ny - 1) / MB_TOPOGRID_TILE_DIM + 1;
+		}
+	else if (status == MB_SUCCESS)
+		{
+		status = mb_read_gmt_grd(verbose, topogrid->file, &topogrid->projection_mode, topogrid->projection_id, &topogrid->nodatavalue,
 				&topogrid->nxy, &topogrid->nx, &topogrid->ny, &topogrid->min, &topogrid->max,
 				&topogrid->xmin, &topogrid->xmax, &topogrid->ymin, &topogrid->ymax,
 				&topogrid->dx, &topogrid->dy, &topogrid->data, NULL, NULL, error);
+		}
 
-	/* check for reasonable results */
-	if (topogrid->nxy <= 0 || topogrid->data == NULL)
+	/* check for reasonable results - nxy counts the nodes held in memory
+		and is not set for tiled grids, whose node count may not fit in
+		an int */
+	if (topogrid->nx <= 0 || topogrid->ny <= 0
+		|| (topogrid->tiled == MB_NO && (topogrid->nxy <= 0 || topogrid->data == NULL)))
 		{
 		status = MB_FAILURE;
 		*error = MB_ERROR_OPEN_FAIL;
@@ -151,6 +185,9 @@ int mb_topogrid_init(int verbose, mb_path topogridfile, int *lonflip,
 		fprintf(stderr,"dbg2       topogrid->dx:              %f\n", topogrid->dx);
 		fprintf(stderr,"dbg2       topogrid->dy               %f\n", topogrid->dy);
 		fprintf(stderr,"dbg2       topogrid->data:            %p\n", topogrid->data);
+		fprintf(stderr,"dbg2       topogrid->tiled:           %d\n", topogrid->tiled);
+		fprintf(stderr,"dbg2       topogrid->ntile_x:         %d\n", topogrid->ntile_x);
+		fprintf(stderr,"dbg2       topogrid->ntile_y:         %d\n", topogrid->ntile_y);
 		fprintf(stderr,"dbg2       error:                     %d\n",*error);
 		fprintf(stderr,"dbg2  Return status:\n");
 		fprintf(stderr,"dbg2       status:                    %d\n",status);
@@ -165,6 +202,7 @@ int mb_topogrid_deall(int verbose, void **topogrid_ptr, int *error)
 	char	*function_name = "mb_topogrid_deall";
 	int	status = MB_SUCCESS;
 	struct mb_topogrid_struct *topogrid;
+	int	i;
 
 	/* print input debug statements */
 	if (verbose >= 2)
@@ -181,6 +219,11 @@ int mb_topogrid_deall(int verbose, void **topogrid_ptr, int *error)
 	topogrid = (struct mb_topogrid_struct *) *topogrid_ptr;
 	if (topogrid->data != NULL)
 		status = mb_freed(verbose, __FILE__, __LINE__, (void **)&(topogrid->data), error);
+	for (i=0;i<MB_TOPOGRID_NTILE;i++)
+		{
+		if (topogrid->tile_data[i] != NULL)
+			status = mb_freed(verbose, __FILE__, __LINE__, (void **)&(topogrid->tile_data[i]), error);
+		}
 	status = mb_freed(verbose,__FILE__, __LINE__, (void **)topogrid_ptr,error);
 
 	/* print output debug statements */
@@ -198,6 +241,70 @@ int mb_topogrid_deall(int verbose, void **topogrid_ptr, int *error)
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+/*
+ * Returns the value of grid node (i, j). For large grids the node is taken
+ * from a small least recently used cache of tiles, reading the tile
+ * containing the node from the grid file when it is not already held.
+ */
+static float mb_topogrid_node(int verbose, struct mb_topogrid_struct *topogrid, int i, int j)
+{
+	int	status = MB_SUCCESS;
+	int	error = MB_ERROR_NO_ERROR;
+	int	itile, jtile, id;
+	int	i0, j0, nxtile, nytile;
+	int	n, nold, k;
+
+	/* whole grid in memory */
+	if (topogrid->tiled == MB_NO)
+		return(topogrid->data[i * topogrid->ny + j]);
+
+	/* get the tile containing the node */
+	itile = i / MB_TOPOGRID_TILE_DIM;
+	jtile = j / MB_TOPOGRID_TILE_DIM;
+	id = itile * topogrid->ntile_y + jtile;
+	i0 = itile * MB_TOPOGRID_TILE_DIM;
+	j0 = jtile * MB_TOPOGRID_TILE_DIM;
+	nxtile = MIN(MB_TOPOGRID_TILE_DIM, topogrid->nx - i0);
+	nytile = MIN(MB_TOPOGRID_TILE_DIM, topogrid->ny - j0);
+
+	/* look for the tile in the cache, noting the least recently used slot */
+	nold = 0;
+	for (n=0;n<MB_TOPOGRID_NTILE && topogrid->tile_id[n] != id;n++)
+		{
+		if (topogrid->tile_use[n] < topogrid->tile_use[nold])
+			nold = n;
+		}
+
+	/* if not found read the tile into the least recently used slot */
+	if (n == MB_TOPOGRID_NTILE)
+		{
+		n = nold;
+		if (topogrid->tile_data[n] == NULL)
+			status = mb_mallocd(verbose, __FILE__, __LINE__,
+					MB_TOPOGRID_TILE_DIM * MB_TOPOGRID_TILE_DIM * sizeof(float),
+					(void **)&(topogrid->tile_data[n]), &error);
+		if (status == MB_FAILURE)
+			return(topogrid->nodatavalue);
+		status = mb_read_gmt_grd_window(verbose, topogrid->file, i0, j0, nxtile, nytile,
+					topogrid->nodatavalue, topogrid->tile_data[n], &error);
+		if (status == MB_FAILURE)
+			{
+			for (k=0;k<nxtile*nytile;k++)
+				topogrid->tile_data[n][k] = topogrid->nodatavalue;
+			}
+		topogrid->tile_id[n] = id;
+		}
+
+	/* mark the tile as most recently used */
+	if (topogrid->tile_use[n] != topogrid->tile_clock || topogrid->tile_clock == 0)
+		{
+		topogrid->tile_clock++;
+		topogrid->tile_use[n] = topogrid->tile_clock;
+		}
+
+	return(topogrid->tile_data[n][(i - i0) * nytile + (j - j0)]);
+}
+/*--------------------------------------------------------------------*/
 int mb_topogrid_topo(int verbose, void *topogrid_ptr,
 			double navlon, double navlat,
 			double *topo, int *error)
@@ -206,7 +313,8 @@ int mb_topogrid_topo(int verbose, void *topogrid_ptr,
 	int	status = MB_SUCCESS;
 	struct mb_topogrid_struct *topogrid;
 	int	nfound;
-	int	i, j, ii, jj, k;
+	float	value;
+	int	i, j, ii, jj;
 
 	/* get pointer to topogrid structure */
 	topogrid = (struct mb_topogrid_struct *) topogrid_ptr;
@@ -249,11 +357,11 @@ int mb_topogrid_topo(int verbose, void *topogrid_ptr,
 		for (ii=i;ii<=i+1;ii++)
 		for (jj=j;jj<=j+1;jj++)
 		    {
-		    k = ii * topogrid->ny + jj;
-		    if (topogrid->data[k] != topogrid->nodatavalue)
+		    value = mb_topogrid_node(verbose, topogrid, ii, jj);
+		    if (value != topogrid->nodatavalue)
 			{
 			nfound++;
-			*topo += topogrid->data[k];
+			*topo += value;
 			}
 		    }
 		}
@@ -302,7 +410,8 @@ int mb_topogrid_intersect(int verbose, void *topogrid_ptr,
 	double	rmin, rmax;
 	double	topotest, topog, dtopo;
 	int	nfound;
-	int	i, j, ii, jj, k;
+	float	value;
+	int	i, j, ii, jj;
 
 	/* get pointer to topogrid structure */
 	topogrid = (struct mb_topogrid_struct *) topogrid_ptr;
@@ -369,11 +478,11 @@ int mb_topogrid_intersect(int verbose, void *topogrid_ptr,
 			for (ii=i;ii<=i+1;ii++)
 			for (jj=j;jj<=j+1;jj++)
 			    {
-			    k = ii * topogrid->ny + jj;
-			    if (topogrid->data[k] != topogrid->nodatavalue)
+			    value = mb_topogrid_node(verbose, topogrid, ii, jj);
+			    if (value != topogrid->nodatavalue)
 				{
 				nfound++;
-				topog += topogrid->data[k];
+				topog += value;
 				}
 			    }
 			}
@@ -415,11 +524,11 @@ int mb_topogrid_intersect(int verbose, void *topogrid_ptr,
 			for (ii=i;ii<=i+1;ii++)
 			for (jj=j;jj<=j+1;jj++)
 			    {
-			    k = ii * topogrid->ny + jj;
-			    if (topogrid->data[k] != topogrid->nodatavalue)
+			    value = mb_topogrid_node(verbose, topogrid, ii, jj);
+			    if (value != topogrid->nodatavalue)
 				{
 				nfound++;
-				topog += topogrid->data[k];
+				topog += value;
 				}
 			    }
 			}
@@ -339,7 +339,263 @@ int mb_read_gmt_grd(int verbose, char *grdfile,
 
 	/* return status */
 	return(status);
-}/*--------------------------------------------------------------------*/
+}
+/*--------------------------------------------------------------------------*/
+/*
+ * function mb_read_gmt_grd_header reads only the header of a GMT grid,
+ * returning the grid dimensions, bounds and projection without loading
+ * any of the grid values. Used together with mb_read_gmt_grd_window()
+ * to access grids that are too large to hold in memory.
+ */
+int mb_read_gmt_grd_header(int verbose, char *grdfile,
+			int	*grid_projection_mode,
+			char	*grid_projection_id,
+			float	*nodatavalue,
+			int	*nx,
+			int	*ny,
+			double	*min,
+			double	*max,
+			double	*xmin,
+			double	*xmax,
+			double	*ymin,
+			double	*ymax,
+			double	*dx,
+			double	*dy,
+			int	*error)
+{
+	char function_name[] = "mb_read_gmt_grd_header";
+	int	status = MB_SUCCESS;
+	void *API = NULL;			/* GMT API control structure pointer */
+	struct GMT_GRID *G = NULL;		/* GMT grid structure pointer */
+	struct GMT_GRID_HEADER *header;		/* GMT grid header structure pointer */
+	int	projectionid;
+	int	utmzone;
+	char	NorS;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBA function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       grdfile:         %s\n", grdfile);
+		}
+
+	/* Initializing new GMT session */
+	if ((API = GMT_Create_Session (function_name, 2U, 0U, NULL)) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_MEMORY_FAIL;
+		return(status);
+		}
+
+	/* read in the grid header only */
+	if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_GRID_HEADER_ONLY, NULL, grdfile, NULL)) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		}
+
+	/* get projection and dimensions */
+	if (status == MB_SUCCESS)
+		{
+		header = G->header;
+		*grid_projection_mode = MB_PROJECTION_GEOGRAPHIC;
+		sprintf(grid_projection_id, "epsg%d", GCS_WGS_84);
+		if (strncmp(&(header->remark[2]), "Projection: ", 12) == 0)
+			{
+			if (sscanf(&(header->remark[2]), "Projection: UTM%d%c", &utmzone, &NorS) == 2)
+				{
+				if (NorS == 'S')
+					projectionid = 32700 + utmzone;
+				else
+					projectionid = 32600 + utmzone;
+				*grid_projection_mode = MB_PROJECTION_PROJECTED;
+				sprintf(grid_projection_id, "epsg%d", projectionid);
+				}
+			else if (sscanf(&(header->remark[2]), "Projection: epsg%d", &projectionid) == 1)
+				{
+				*grid_projection_mode = MB_PROJECTION_PROJECTED;
+				sprintf(grid_projection_id, "epsg%d", projectionid);
+				}
+			}
+
+    		*nodatavalue = MIN(MB_DEFAULT_GRID_NODATA, header->z_min - 10 * (header->z_max - header->z_min));
+    		*nx = header->nx;
+    		*ny = header->ny;
+    		*xmin = header->wesn[0];
+    		*xmax = header->wesn[1];
+    		*ymin = header->wesn[2];
+    		*ymax = header->wesn[3];
+    		*dx = header->inc[0];
+    		*dy = header->inc[1];
+    		*min = header->z_min;
+    		*max = header->z_max;
+		}
+
+	/* Destroy GMT session */
+	if (GMT_Destroy_Session (API) != 0 && status == MB_SUCCESS)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_MEMORY_FAIL;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBA function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		if (status == MB_SUCCESS)
+			{
+			fprintf(stderr,"dbg2       grid_projection_mode:     %d\n", *grid_projection_mode);
+			fprintf(stderr,"dbg2       grid_projection_id:       %s\n", grid_projection_id);
+			fprintf(stderr,"dbg2       nodatavalue:              %f\n", *nodatavalue);
+			fprintf(stderr,"dbg2       nx:                       %d\n", *nx);
+			fprintf(stderr,"dbg2       ny:                       %d\n", *ny);
+			fprintf(stderr,"dbg2       min:                      %f\n", *min);
+			fprintf(stderr,"dbg2       max:                      %f\n", *max);
+			fprintf(stderr,"dbg2       xmin:                     %f\n", *xmin);
+			fprintf(stderr,"dbg2       xmax:                     %f\n", *xmax);
+			fprintf(stderr,"dbg2       ymin:                     %f\n", *ymin);
+			fprintf(stderr,"dbg2       ymax:                     %f\n", *ymax);
+			fprintf(stderr,"dbg2       dx:                       %f\n", *dx);
+			fprintf(stderr,"dbg2       dy:                       %f\n", *dy);
+			}
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------------*/
+/*
+ * function mb_read_gmt_grd_window reads the nx_window by ny_window block of
+ * grid nodes starting at node (i0, j0) into the caller supplied array data,
+ * using the same node ordering as mb_read_gmt_grd() (k = i * ny_window + j,
+ * with j increasing northward). Only the requested subregion is read from
+ * the file, so arbitrarily large grids can be accessed piecewise.
+ */
+int mb_read_gmt_grd_window(int verbose, char *grdfile,
+			int	i0,
+			int	j0,
+			int	nx_window,
+			int	ny_window,
+			float	nodatavalue,
+			float	*data,
+			int	*error)
+{
+	char function_name[] = "mb_read_gmt_grd_window";
+	int	status = MB_SUCCESS;
+	void *API = NULL;			/* GMT API control structure pointer */
+	struct GMT_GRID *G = NULL;		/* GMT grid structure pointer */
+	struct GMT_GRID_HEADER *header;		/* GMT grid header structure pointer */
+	double	wesn[4];
+	double	offset;
+	int	nx, ny;
+	int	i, j, k, kk;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBA function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       grdfile:         %s\n", grdfile);
+		fprintf(stderr,"dbg2       i0:              %d\n", i0);
+		fprintf(stderr,"dbg2       j0:              %d\n", j0);
+		fprintf(stderr,"dbg2       nx_window:       %d\n", nx_window);
+		fprintf(stderr,"dbg2       ny_window:       %d\n", ny_window);
+		fprintf(stderr,"dbg2       nodatavalue:     %f\n", nodatavalue);
+		fprintf(stderr,"dbg2       data:            %p\n", (void *)data);
+		}
+
+	/* Initializing new GMT session */
+	if ((API = GMT_Create_Session (function_name, 2U, 0U, NULL)) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_MEMORY_FAIL;
+		return(status);
+		}
+
+	/* read in the grid header */
+	if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_GRID_HEADER_ONLY, NULL, grdfile, NULL)) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		}
+
+	/* check that the window lies within the grid */
+	if (status == MB_SUCCESS)
+		{
+		header = G->header;
+		if (i0 < 0 || j0 < 0 || nx_window <= 0 || ny_window <= 0
+			|| i0 + nx_window > header->nx || j0 + ny_window > header->ny)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_BAD_PARAMETER;
+			}
+		}
+
+	/* read in only the nodes of the window */
+	if (status == MB_SUCCESS)
+		{
+		offset = (header->registration == GMT_GRID_PIXEL_REG ? 1.0 : 0.0);
+		wesn[0] = header->wesn[0] + i0 * header->inc[0];
+		wesn[1] = header->wesn[0] + (i0 + nx_window - 1 + offset) * header->inc[0];
+		wesn[2] = header->wesn[2] + j0 * header->inc[1];
+		wesn[3] = header->wesn[2] + (j0 + ny_window - 1 + offset) * header->inc[1];
+		if (GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_GRID_DATA_ONLY, wesn, grdfile, G) == NULL)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_EOF;
+			}
+		}
+
+	/* copy grid data, reordering to internal convention */
+	if (status == MB_SUCCESS)
+		{
+		header = G->header;
+		nx = MIN(nx_window, header->nx);
+		ny = MIN(ny_window, header->ny);
+		for (k=0;k<nx_window*ny_window;k++)
+			data[k] = nodatavalue;
+		for (i=0;i<nx;i++)
+		for (j=0;j<ny;j++)
+			{
+			k = i * ny_window + j;
+			kk = (header->ny + header->pad[2] + header->pad[3] - 1 - j)
+				* (header->nx + header->pad[0] + header->pad[1])
+				+ (i + header->pad[0]);
+			if (!MB_IS_FNAN(G->data[kk]))
+				data[k] = G->data[kk];
+			}
+		}
+
+	/* Destroy GMT session */
+	if (GMT_Destroy_Session (API) != 0 && status == MB_SUCCESS)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_MEMORY_FAIL;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBA function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 /*
  * function write_cdfgrd writes output grid to a
  * GMT version 2 netCDF grd file
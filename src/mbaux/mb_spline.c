@@ -23,6 +23,11 @@
  * The 1D linear interpolation routine is homegrown, but mimics the
  * spline routines in usage.
  *
+ * On input the interval index i is used as a guess of the interval
+ * holding x, so callers stepping through a series should keep the
+ * value returned by the previous call. Any value may be passed; a
+ * guess that does not bracket x is ignored.
+ *
  * Author:	D. W. Caress
  * Date:	October 11, 2000
  *
@@ -153,13 +158,29 @@ int mb_spline_interp(int verbose, double *xa, double *ya, double *y2a,
 	/* perform interpolation */
 	if (status == MB_SUCCESS)
 		{
-		klo=1;
-		khi=n;
-		while (khi-klo > 1)
+		/* try the interval found by the previous call and the one
+			after it before doing a binary search - this makes
+			stepping through a time series cheap */
+		klo = *i;
+		if (klo >= 1 && klo < n
+			&& xa[klo] <= x && xa[klo+1] > x)
+			khi = klo + 1;
+		else if (klo >= 1 && klo < n - 1
+			&& xa[klo+1] <= x && xa[klo+2] > x)
+			{
+			klo = klo + 1;
+			khi = klo + 1;
+			}
+		else
 			{
-			k=(khi+klo) >> 1;
-			if (xa[k] > x) khi=k;
-			else klo=k;
+			klo=1;
+			khi=n;
+			while (khi-klo > 1)
+				{
+				k=(khi+klo) >> 1;
+				if (xa[k] > x) khi=k;
+				else klo=k;
+				}
 			}
 		if (khi == 1) khi = 2;
 		if (klo == n) klo = n - 1;
@@ -232,13 +253,29 @@ int mb_linear_interp(int verbose, double *xa, double *ya,
 		/* in range of model so linearly interpolate */
 		else
 			{
-			klo=1;
-			khi=n;
-			while (khi-klo > 1)
+			/* try the interval found by the previous call and the one
+				after it before doing a binary search - this makes
+				stepping through a time series cheap */
+			klo = *i;
+			if (klo >= 1 && klo < n
+				&& xa[klo] <= x && xa[klo+1] > x)
+				khi = klo + 1;
+			else if (klo >= 1 && klo < n - 1
+				&& xa[klo+1] <= x && xa[klo+2] > x)
 				{
-				k=(khi+klo) >> 1;
-				if (xa[k] > x) khi=k;
-				else klo=k;
+				klo = klo + 1;
+				khi = klo + 1;
+				}
+			else
+				{
+				klo=1;
+				khi=n;
+				while (khi-klo > 1)
+					{
+					k=(khi+klo) >> 1;
+					if (xa[k] > x) khi=k;
+					else klo=k;
+					}
 				}
 			if (khi == 1) khi = 2;
 			if (klo == n) klo = n - 1;
@@ -311,13 +348,29 @@ int mb_linear_interp_longitude(int verbose, double *xa, double *ya,
 		/* in range of model so linearly interpolate */
 		else
 			{
-			klo=1;
-			khi=n;
-			while (khi-klo > 1)
+			/* try the interval found by the previous call and the one
+				after it before doing a binary search - this makes
+				stepping through a time series cheap */
+			klo = *i;
+			if (klo >= 1 && klo < n
+				&& xa[klo] <= x && xa[klo+1] > x)
+				khi = klo + 1;
+			else if (klo >= 1 && klo < n - 1
+				&& xa[klo+1] <= x && xa[klo+2] > x)
 				{
-				k=(khi+klo) >> 1;
-				if (xa[k] > x) khi=k;
-				else klo=k;
+				klo = klo + 1;
+				khi = klo + 1;
+				}
+			else
+				{
+				klo=1;
+				khi=n;
+				while (khi-klo > 1)
+					{
+					k=(khi+klo) >> 1;
+					if (xa[k] > x) khi=k;
+					else klo=k;
+					}
 				}
 			if (khi == 1) khi = 2;
 			if (klo == n) klo = n - 1;
@@ -400,13 +453,29 @@ int mb_linear_interp_latitude(int verbose, double *xa, double *ya,
 		/* in range of model so linearly interpolate */
 		else
 			{
-			klo=1;
-			khi=n;
-			while (khi-klo > 1)
+			/* try the interval found by the previous call and the one
+				after it before doing a binary search - this makes
+				stepping through a time series cheap */
+			klo = *i;
+			if (klo >= 1 && klo < n
+				&& xa[klo] <= x && xa[klo+1] > x)
+				khi = klo + 1;
+			else if (klo >= 1 && klo < n - 1
+				&& xa[klo+1] <= x && xa[klo+2] > x)
 				{
-				k=(khi+klo) >> 1;
-				if (xa[k] > x) khi=k;
-				else klo=k;
+				klo = klo + 1;
+				khi = klo + 1;
+				}
+			else
+				{
+				klo=1;
+				khi=n;
+				while (khi-klo > 1)
+					{
+					k=(khi+klo) >> 1;
+					if (xa[k] > x) khi=k;
+					else klo=k;
+					}
 				}
 			if (khi == 1) khi = 2;
 			if (klo == n) klo = n - 1;
@@ -485,13 +554,29 @@ int mb_linear_interp_heading(int verbose, double *xa, double *ya,
 		/* in range of model so linearly interpolate */
 		else
 			{
-			klo=1;
-			khi=n;
-			while (khi-klo > 1)
+			/* try the interval found by the previous call and the one
+				after it before doing a binary search - this makes
+				stepping through a time series cheap */
+			klo = *i;
+			if (klo >= 1 && klo < n
+				&& xa[klo] <= x && xa[klo+1] > x)
+				khi = klo + 1;
+			else if (klo >= 1 && klo < n - 1
+				&& xa[klo+1] <= x && xa[klo+2] > x)
 				{
-				k=(khi+klo) >> 1;
-				if (xa[k] > x) khi=k;
-				else klo=k;
+				klo = klo + 1;
+				khi = klo + 1;
+				}
+			else
+				{
+				klo=1;
+				khi=n;
+				while (khi-klo > 1)
+					{
+					k=(khi+klo) >> 1;
+					if (xa[k] > x) khi=k;
+					else klo=k;
+					}
 				}
 			if (khi == 1) khi = 2;
 			if (klo == n) klo = n - 1;
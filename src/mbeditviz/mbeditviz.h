@@ -84,6 +84,11 @@
 #define MBEV_USE_YES		1
 #define MBEV_USE_CONDITIONAL	2
 
+/* status of the projected sounding bounds kept for each ping and file */
+#define MBEV_BOUNDS_UNKNOWN	0
+#define MBEV_BOUNDS_EMPTY	1
+#define MBEV_BOUNDS_SET		2
+
 /* mbeditviz structures */
 struct	mbev_ping_struct
 	{
@@ -126,6 +131,8 @@ struct	mbev_ping_struct
 	double	*ttimes;
 	double	*bheave;
 	double	*alongtrack_offset;
+	int	bounds_status;
+	double	bounds[4];
 	};
 struct mbev_file_struct
 	{
@@ -147,6 +154,8 @@ struct mbev_file_struct
 	int	num_pings;
 	int	num_pings_alloc;
 	struct mbev_ping_struct *pings;
+	int	bounds_status;
+	double	bounds[4];
 	double	beamwidth_xtrack;
 	double	beamwidth_ltrack;
         int     topo_type;
@@ -294,6 +303,9 @@ int mbeditviz_beam_position(double navlon, double navlat, double headingx, doubl
 				double sonardepth,
 				double rollbias, double pitchbias,
 				double *bathcorr, double *lon, double *lat);
+int mbeditviz_ping_bounds(struct mbev_file_struct *file, struct mbev_ping_struct *ping);
+int mbeditviz_check_bounds(int bounds_status, double *bounds,
+				double xmin, double xmax, double ymin, double ymax);
 int mbeditviz_unload_file(int ifile);
 int mbeditviz_delete_file(int ifile);
 double mbeditviz_erf(double x);
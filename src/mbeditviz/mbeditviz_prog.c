@@ -822,129 +822,34 @@ int mbeditviz_load_file(int ifile)
 				if (mbev_error == MB_ERROR_NO_ERROR
 				    && kind == MB_DATA_DATA)
 					{
-					if ((ping->beamflag = (char *) malloc(ping->beams_bath)) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->beamflagorg = (char *) malloc(ping->beams_bath)) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->beamcolor = (int *) malloc(sizeof(int) * ping->beams_bath)) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bath = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathacrosstrack = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathalongtrack = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathcorr = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathlon = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathlat = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathx = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bathy = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->angles = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->angles_forward = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->angles_null = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->ttimes = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->bheave = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if ((ping->alongtrack_offset = (double *) malloc(sizeof(double) * (ping->beams_bath))) == NULL)
-						mbev_error = MB_ERROR_MEMORY_FAIL;
-					if (mbev_error == MB_ERROR_MEMORY_FAIL)
+					/* the per beam arrays of a ping share one allocation -
+						the double arrays first (starting with bath, which
+						owns the block), then the colors and the flags */
+					if ((ping->bath = (double *) malloc(MAX(ping->beams_bath, 1)
+							* (14 * sizeof(double) + sizeof(int) + 2 * sizeof(char)))) == NULL)
 						{
 fprintf(stderr,"MEMORY FAILURE in mbeditviz_load_file\n");
+						mbev_error = MB_ERROR_MEMORY_FAIL;
 						mbev_status = MB_FAILURE;
-						if (ping->beamflag != NULL)
-							{
-							free(ping->beamflag);
-							ping->beamflag = NULL;
-							}
-						if (ping->beamflagorg != NULL)
-							{
-							free(ping->beamflagorg);
-							ping->beamflagorg = NULL;
-							}
-						if (ping->beamcolor != NULL)
-							{
-							free(ping->beamcolor);
-							ping->beamcolor = NULL;
-							}
-						if (ping->bath != NULL)
-							{
-							free(ping->bath);
-							ping->bath = NULL;
-							}
-						if (ping->bathacrosstrack != NULL)
-							{
-							free(ping->bathacrosstrack);
-							ping->bathacrosstrack = NULL;
-							}
-						if (ping->bathalongtrack != NULL)
-							{
-							free(ping->bathalongtrack);
-							ping->bathalongtrack = NULL;
-							}
-						if (ping->bathcorr != NULL)
-							{
-							free(ping->bathcorr);
-							ping->bathcorr = NULL;
-							}
-						if (ping->bathlon != NULL)
-							{
-							free(ping->bathlon);
-							ping->bathlon = NULL;
-							}
-						if (ping->bathlat != NULL)
-							{
-							free(ping->bathlat);
-							ping->bathlat = NULL;
-							}
-						if (ping->bathx != NULL)
-							{
-							free(ping->bathx);
-							ping->bathx = NULL;
-							}
-						if (ping->bathy != NULL)
-							{
-							free(ping->bathy);
-							ping->bathy = NULL;
-							}
-						if (ping->angles != NULL)
-							{
-							free(ping->angles);
-							ping->angles = NULL;
-							}
-						if (ping->angles_forward != NULL)
-							{
-							free(ping->angles_forward);
-							ping->angles_forward = NULL;
-							}
-						if (ping->angles_null != NULL)
-							{
-							free(ping->angles_null);
-							ping->angles_null = NULL;
-							}
-						if (ping->ttimes != NULL)
-							{
-							free(ping->ttimes);
-							ping->ttimes = NULL;
-							}
-						if (ping->bheave != NULL)
-							{
-							free(ping->bheave);
-							ping->bheave = NULL;
-							}
-						if (ping->alongtrack_offset != NULL)
-							{
-							free(ping->alongtrack_offset);
-							ping->alongtrack_offset = NULL;
-							}
+						}
+					else
+						{
+						ping->bathacrosstrack = &ping->bath[ping->beams_bath];
+						ping->bathalongtrack = &ping->bathacrosstrack[ping->beams_bath];
+						ping->bathcorr = &ping->bathalongtrack[ping->beams_bath];
+						ping->bathlon = &ping->bathcorr[ping->beams_bath];
+						ping->bathlat = &ping->bathlon[ping->beams_bath];
+						ping->bathx = &ping->bathlat[ping->beams_bath];
+						ping->bathy = &ping->bathx[ping->beams_bath];
+						ping->angles = &ping->bathy[ping->beams_bath];
+						ping->angles_forward = &ping->angles[ping->beams_bath];
+						ping->angles_null = &ping->angles_forward[ping->beams_bath];
+						ping->ttimes = &ping->angles_null[ping->beams_bath];
+						ping->bheave = &ping->ttimes[ping->beams_bath];
+						ping->alongtrack_offset = &ping->bheave[ping->beams_bath];
+						ping->beamcolor = (int *) &ping->alongtrack_offset[ping->beams_bath];
+						ping->beamflag = (char *) &ping->beamcolor[ping->beams_bath];
+						ping->beamflagorg = &ping->beamflag[ping->beams_bath];
 						}
 					}
 /* fprintf(stderr,"num_pings:%d ping:%p beamflags: %p %p\n",file->num_pings,ping,ping->beamflag,ping->beamflagorg); */
@@ -1066,9 +971,6 @@ fprintf(stderr,"     Beam bathymetry: %d %f %f %f\n",ibeam,ping->bath[ibeam],pin
 								}
 							}
 
-						mb_coor_scale(mbev_verbose,ping->navlat,&mtodeglon,&mtodeglat);
-						headingx = sin(ping->heading * DTR);
-						headingy = cos(ping->heading * DTR);
 						if (icenter >= 0)
 							{
 							ping->portlon = ping->bathlon[iport];
@@ -1643,6 +1545,7 @@ swathfile,file->processed_info_loaded,file->process.mbp_edit_mode);
 		if (mbev_status == MB_SUCCESS)
 			{
 			file->load_status = MB_YES;
+			file->bounds_status = MBEV_BOUNDS_UNKNOWN;
 			mbev_num_files_loaded++;
 			}
 		}
@@ -1671,9 +1574,14 @@ int mbeditviz_apply_timelag(struct mbev_file_struct *file, struct mbev_ping_stru
 	char	*function_name = "mbeditviz_apply_timelag";
 	double	time_d;
 	int	intstat;
-	int	iheading = 0;
-	int	isonardepth = 0;
-	int	iattitude = 0;
+
+	/* interpolation intervals found by the previous call - successive
+		pings usually fall in the same or the next interval, and the
+		interpolation routines check the hints before using them */
+	static int	iheading = 0;
+	static int	isonardepth = 0;
+	static int	isyncattitude = 0;
+	static int	iasyncattitude = 0;
 	double	rollsync, pitchsync;
 	double	rollasync, pitchasync;
 
@@ -1733,19 +1641,19 @@ int mbeditviz_apply_timelag(struct mbev_file_struct *file, struct mbev_ping_stru
 			{
 			intstat = mb_linear_interp(mbev_verbose,
 					file->sync_attitude_time_d-1, file->sync_attitude_roll-1,
-					file->n_sync_attitude, ping->time_d, &rollsync, &iattitude,
+					file->n_sync_attitude, ping->time_d, &rollsync, &isyncattitude,
 					&mbev_error);
 			intstat = mb_linear_interp(mbev_verbose,
 					file->sync_attitude_time_d-1, file->sync_attitude_pitch-1,
-					file->n_sync_attitude, ping->time_d, &pitchsync, &iattitude,
+					file->n_sync_attitude, ping->time_d, &pitchsync, &isyncattitude,
 					&mbev_error);
 			intstat = mb_linear_interp(mbev_verbose,
 					file->async_attitude_time_d-1, file->async_attitude_roll-1,
-					file->n_async_attitude, time_d, &rollasync, &iattitude,
+					file->n_async_attitude, time_d, &rollasync, &iasyncattitude,
 					&mbev_error);
 			intstat = mb_linear_interp(mbev_verbose,
 					file->async_attitude_time_d-1, file->async_attitude_pitch-1,
-					file->n_async_attitude, time_d, &pitchasync, &iattitude,
+					file->n_async_attitude, time_d, &pitchasync, &iasyncattitude,
 					&mbev_error);
 			*rolldelta = rollasync - rollsync + rollbias;
 			*pitchdelta = pitchasync - pitchsync + pitchbias;
@@ -1757,8 +1665,8 @@ int mbeditviz_apply_timelag(struct mbev_file_struct *file, struct mbev_ping_stru
 			}
 /*fprintf(stderr,"heading: %f %f   %f %d\n", *heading, ping->heading, *heading-ping->heading, iheading);
 fprintf(stderr,"sonardepth: %f %f   %f %d\n", *sonardepth, ping->sonardepth,*sonardepth-ping->sonardepth, isonardepth);
-fprintf(stderr,"rolldelta:  %f %f    roll:%f %f   %d\n", *rolldelta, rollbias, rollasync, rollsync, iattitude);
-fprintf(stderr,"pitchdelta: %f %f    pitch:%f %f   %d\n", *pitchdelta, pitchbias, pitchasync, pitchsync, iattitude);*/
+fprintf(stderr,"rolldelta:  %f %f    roll:%f %f   %d\n", *rolldelta, rollbias, rollasync, rollsync, iasyncattitude);
+fprintf(stderr,"pitchdelta: %f %f    pitch:%f %f   %d\n", *pitchdelta, pitchbias, pitchasync, pitchsync, iasyncattitude);*/
 		}
 
 	/* print output debug statements */
@@ -1899,6 +1807,131 @@ fprintf(stderr,"     lat:         %f\n",*lat);
 	return(mbev_status);
 }
 /*--------------------------------------------------------------------*/
+int mbeditviz_ping_bounds(struct mbev_file_struct *file, struct mbev_ping_struct *ping)
+{
+	/* local variables */
+	char	*function_name = "mbeditviz_ping_bounds";
+	int	ibeam;
+
+	/* print input debug statements */
+	if (mbev_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       file:        %p\n",(void *)file);
+		fprintf(stderr,"dbg2       ping:        %p\n",(void *)ping);
+		}
+
+	/* get the projected bounds of the non-null soundings of this ping */
+	ping->bounds_status = MBEV_BOUNDS_EMPTY;
+	for (ibeam=0;ibeam<ping->beams_bath;ibeam++)
+		{
+		if (!mb_beam_check_flag_null(ping->beamflag[ibeam]))
+			{
+			if (ping->bounds_status == MBEV_BOUNDS_EMPTY)
+				{
+				ping->bounds[0] = ping->bathx[ibeam];
+				ping->bounds[1] = ping->bathx[ibeam];
+				ping->bounds[2] = ping->bathy[ibeam];
+				ping->bounds[3] = ping->bathy[ibeam];
+				ping->bounds_status = MBEV_BOUNDS_SET;
+				}
+			else
+				{
+				ping->bounds[0] = MIN(ping->bounds[0], ping->bathx[ibeam]);
+				ping->bounds[1] = MAX(ping->bounds[1], ping->bathx[ibeam]);
+				ping->bounds[2] = MIN(ping->bounds[2], ping->bathy[ibeam]);
+				ping->bounds[3] = MAX(ping->bounds[3], ping->bathy[ibeam]);
+				}
+			}
+		}
+
+	/* the file bounds are only ever extended here - they are reset
+		whenever all of the soundings of the file are reprojected */
+	if (ping->bounds_status == MBEV_BOUNDS_SET)
+		{
+		if (file->bounds_status == MBEV_BOUNDS_EMPTY)
+			{
+			file->bounds[0] = ping->bounds[0];
+			file->bounds[1] = ping->bounds[1];
+			file->bounds[2] = ping->bounds[2];
+			file->bounds[3] = ping->bounds[3];
+			file->bounds_status = MBEV_BOUNDS_SET;
+			}
+		else if (file->bounds_status == MBEV_BOUNDS_SET)
+			{
+			file->bounds[0] = MIN(file->bounds[0], ping->bounds[0]);
+			file->bounds[1] = MAX(file->bounds[1], ping->bounds[1]);
+			file->bounds[2] = MIN(file->bounds[2], ping->bounds[2]);
+			file->bounds[3] = MAX(file->bounds[3], ping->bounds[3]);
+			}
+		}
+
+	/* print output debug statements */
+	if (mbev_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       bounds_status: %d\n",ping->bounds_status);
+		fprintf(stderr,"dbg2       bounds[0]:     %f\n",ping->bounds[0]);
+		fprintf(stderr,"dbg2       bounds[1]:     %f\n",ping->bounds[1]);
+		fprintf(stderr,"dbg2       bounds[2]:     %f\n",ping->bounds[2]);
+		fprintf(stderr,"dbg2       bounds[3]:     %f\n",ping->bounds[3]);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       mbev_status: %d\n",mbev_status);
+		}
+
+	/* return */
+	return(mbev_status);
+}
+/*--------------------------------------------------------------------*/
+int mbeditviz_check_bounds(int bounds_status, double *bounds,
+				double xmin, double xmax, double ymin, double ymax)
+{
+	/* local variables */
+	char	*function_name = "mbeditviz_check_bounds";
+	int	overlap;
+
+	/* print input debug statements */
+	if (mbev_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       bounds_status: %d\n",bounds_status);
+		fprintf(stderr,"dbg2       bounds:        %p\n",(void *)bounds);
+		fprintf(stderr,"dbg2       xmin:          %f\n",xmin);
+		fprintf(stderr,"dbg2       xmax:          %f\n",xmax);
+		fprintf(stderr,"dbg2       ymin:          %f\n",ymin);
+		fprintf(stderr,"dbg2       ymax:          %f\n",ymax);
+		}
+
+	/* soundings of a ping or file whose bounds are not known must
+		still be checked one by one */
+	if (bounds_status == MBEV_BOUNDS_EMPTY)
+		overlap = MB_NO;
+	else if (bounds_status == MBEV_BOUNDS_SET
+		&& (bounds[1] < xmin || bounds[0] > xmax
+			|| bounds[3] < ymin || bounds[2] > ymax))
+		overlap = MB_NO;
+	else
+		overlap = MB_YES;
+
+	/* print output debug statements */
+	if (mbev_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       overlap:     %d\n",overlap);
+		}
+
+	/* return */
+	return(overlap);
+}
+/*--------------------------------------------------------------------*/
 int mbeditviz_unload_file(int ifile)
 {
 	/* local variables */
@@ -1930,91 +1963,29 @@ int mbeditviz_unload_file(int ifile)
 		    for (iping=0;iping<file->num_pings;iping++)
 			{
 			ping = &(file->pings[iping]);
-			if (ping->beamflag != NULL)
-				{
-				free(ping->beamflag);
-				ping->beamflag = NULL;
-				}
-			if (ping->beamflagorg != NULL)
-				{
-				free(ping->beamflagorg);
-				ping->beamflagorg = NULL;
-				}
-			if (ping->beamcolor != NULL)
-				{
-				free(ping->beamcolor);
-				ping->beamcolor = NULL;
-				}
+
+			/* the per beam arrays share one allocation owned by bath */
 			if (ping->bath != NULL)
 				{
 				free(ping->bath);
 				ping->bath = NULL;
 				}
-			if (ping->bathacrosstrack != NULL)
-				{
-				free(ping->bathacrosstrack);
-				ping->bathacrosstrack = NULL;
-				}
-			if (ping->bathalongtrack != NULL)
-				{
-				free(ping->bathalongtrack);
-				ping->bathalongtrack = NULL;
-				}
-			if (ping->bathcorr != NULL)
-				{
-				free(ping->bathcorr);
-				ping->bathcorr = NULL;
-				}
-			if (ping->bathlon != NULL)
-				{
-				free(ping->bathlon);
-				ping->bathlon = NULL;
-				}
-			if (ping->bathlat != NULL)
-				{
-				free(ping->bathlat);
-				ping->bathlat = NULL;
-				}
-			if (ping->bathx != NULL)
-				{
-				free(ping->bathx);
-				ping->bathx = NULL;
-				}
-			if (ping->bathy != NULL)
-				{
-				free(ping->bathy);
-				ping->bathy = NULL;
-				}
-			if (ping->angles != NULL)
-				{
-				free(ping->angles);
-				ping->angles = NULL;
-				}
-			if (ping->angles_forward != NULL)
-				{
-				free(ping->angles_forward);
-				ping->angles_forward = NULL;
-				}
-			if (ping->angles_null != NULL)
-				{
-				free(ping->angles_null);
-				ping->angles_null = NULL;
-				}
-			if (ping->ttimes != NULL)
-				{
-				free(ping->ttimes);
-				ping->ttimes = NULL;
-				}
-			if (ping->bheave != NULL)
-				{
-				free(ping->bheave);
-				ping->bheave = NULL;
-				}
-			if (ping->alongtrack_offset != NULL)
-				{
-				free(ping->alongtrack_offset);
-				ping->alongtrack_offset = NULL;
-				}
+			ping->beamflag = NULL;
+			ping->beamflagorg = NULL;
+			ping->beamcolor = NULL;
+			ping->bathacrosstrack = NULL;
+			ping->bathalongtrack = NULL;
+			ping->bathcorr = NULL;
+			ping->bathlon = NULL;
+			ping->bathlat = NULL;
+			ping->bathx = NULL;
+			ping->bathy = NULL;
+			ping->angles = NULL;
+			ping->angles_forward = NULL;
+			ping->angles_null = NULL;
+			ping->ttimes = NULL;
+			ping->bheave = NULL;
+			ping->alongtrack_offset = NULL;
 			}
 		    free(file->pings);
 		    file->pings = NULL;
@@ -2628,6 +2599,7 @@ int mbeditviz_project_soundings()
 	struct mbev_file_struct *file;
 	struct mbev_ping_struct *ping;
 	int	ifile, iping, ibeam;
+	int	istart;
 	int	filecount;
 
 	/* print input debug statements */
@@ -2651,6 +2623,7 @@ int mbeditviz_project_soundings()
 				filecount++;
 				sprintf(message, "Projecting file %d of %d...", filecount, mbev_num_files_loaded);
 				do_mbeditviz_message_on(message);
+				file->bounds_status = MBEV_BOUNDS_EMPTY;
 				for (iping=0;iping<file->num_pings;iping++)
 					{
 					ping = &(file->pings[iping]);
@@ -2658,16 +2631,28 @@ int mbeditviz_project_soundings()
 							ping->navlon, ping->navlat,
 							&ping->navlonx, &ping->navlaty,
 							&mbev_error);
-					for (ibeam=0;ibeam<ping->beams_bath;ibeam++)
+
+					/* project each run of non-null beams with one call */
+					istart = -1;
+					for (ibeam=0;ibeam<=ping->beams_bath;ibeam++)
 						{
-						if (!mb_beam_check_flag_null(ping->beamflag[ibeam]))
+						if (ibeam < ping->beams_bath
+							&& !mb_beam_check_flag_null(ping->beamflag[ibeam]))
 							{
-							mb_proj_forward(mbev_verbose, mbev_grid.pjptr,
-									ping->bathlon[ibeam], ping->bathlat[ibeam],
-									&ping->bathx[ibeam], &ping->bathy[ibeam],
+							if (istart < 0)
+								istart = ibeam;
+							}
+						else if (istart >= 0)
+							{
+							mb_proj_forward_array(mbev_verbose, mbev_grid.pjptr,
+									ibeam - istart,
+									&ping->bathlon[istart], &ping->bathlat[istart],
+									&ping->bathx[istart], &ping->bathy[istart],
 									&mbev_error);
+							istart = -1;
 							}
 						}
+					mbeditviz_ping_bounds(file, ping);
 					}
 				}
 			}
@@ -3249,6 +3234,7 @@ mbev_grid.dx,mbev_grid.dy,mbev_grid.nx,mbev_grid.ny);
 				filecount++;
 				sprintf(message, "Gridding file %d of %d...", filecount, mbev_num_files_loaded);
 				do_mbeditviz_message_on(message);
+				file->bounds_status = MBEV_BOUNDS_EMPTY;
 				for (iping=0;iping<file->num_pings;iping++)
 					{
 					ping = &(file->pings[iping]);
@@ -3273,6 +3259,7 @@ mbev_grid.dx,mbev_grid.dy,mbev_grid.nx,mbev_grid.ny);
 							mbev_grid.sgm[k] += ping->bathcorr[ibeam] * ping->bathcorr[ibeam];
 							}
 						}
+					mbeditviz_ping_bounds(file, ping);
 					}
 				}
 			}
@@ -3464,6 +3451,8 @@ int mbeditviz_selectregion(size_t instance)
 	double	rolldelta, pitchdelta;
 	double	headingx, headingy;
 	double	mtodeglon, mtodeglat;
+	double	sxmin, sxmax, symin, symax;
+	int	nselected;
 	int	i, ifile, iping, ibeam;
 
 	/* print input debug statements */
@@ -3528,15 +3517,28 @@ region->cornerpoints[3].xgrid,region->cornerpoints[3].ygrid);
 		mbev_selected.num_soundings_unflagged = 0;
 		mbev_selected.num_soundings_flagged = 0;
 
+		/* files and pings lying outside the region are skipped
+			using their projected sounding bounds */
+		sxmin = xmin;
+		sxmax = xmax;
+		symin = ymin;
+		symax = ymax;
+
 		/* loop over all files */
 		for (ifile=0;ifile<mbev_num_files;ifile++)
 			{
 			file = &mbev_files[ifile];
-			if (file->load_status == MB_YES)
+			if (file->load_status == MB_YES
+				&& mbeditviz_check_bounds(file->bounds_status, file->bounds,
+							sxmin, sxmax, symin, symax) == MB_YES)
 				{
 				for (iping=0;iping<file->num_pings;iping++)
 					{
 					ping = &(file->pings[iping]);
+					if (mbeditviz_check_bounds(ping->bounds_status, ping->bounds,
+							sxmin, sxmax, symin, symax) == MB_NO)
+						continue;
+					nselected = mbev_selected.num_soundings;
 					mbeditviz_apply_timelag(file, ping,
 								mbev_rollbias_3dsdg, mbev_pitchbias_3dsdg, mbev_headingbias_3dsdg, mbev_timelag_3dsdg,
 								&heading, &sonardepth,
@@ -3620,6 +3622,8 @@ mbev_selected.soundings[mbev_selected.num_soundings].z);*/
 								}
 							}
 						}
+					if (mbev_selected.num_soundings > nselected)
+						mbeditviz_ping_bounds(file, ping);
 					}
 				}
 			}
@@ -3666,6 +3670,8 @@ int mbeditviz_selectarea(size_t instance)
 	double	rolldelta, pitchdelta;
 	double	headingx, headingy;
 	double	mtodeglon, mtodeglat;
+	double	sxmin, sxmax, symin, symax, sdx, sdy;
+	int	nselected;
 	int	i;
 
 	/* print input debug statements */
@@ -3711,15 +3717,32 @@ area->cornerpoints[3].xgrid,area->cornerpoints[3].ygrid);
 		mbev_selected.num_soundings_unflagged = 0;
 		mbev_selected.num_soundings_flagged = 0;
 
+		/* files and pings lying outside the box enclosing the rotated
+			area are skipped using their projected sounding bounds */
+		sdx = mbev_selected.xmax * fabs(mbev_selected.sinbearing)
+			+ mbev_selected.ymax * fabs(mbev_selected.cosbearing);
+		sdy = mbev_selected.xmax * fabs(mbev_selected.cosbearing)
+			+ mbev_selected.ymax * fabs(mbev_selected.sinbearing);
+		sxmin = mbev_selected.xorigin - sdx;
+		sxmax = mbev_selected.xorigin + sdx;
+		symin = mbev_selected.yorigin - sdy;
+		symax = mbev_selected.yorigin + sdy;
+
 		/* loop over all files */
 		for (ifile=0;ifile<mbev_num_files;ifile++)
 			{
 			file = &mbev_files[ifile];
-			if (file->load_status == MB_YES)
+			if (file->load_status == MB_YES
+				&& mbeditviz_check_bounds(file->bounds_status, file->bounds,
+							sxmin, sxmax, symin, symax) == MB_YES)
 				{
 				for (iping=0;iping<file->num_pings;iping++)
 					{
 					ping = &(file->pings[iping]);
+					if (mbeditviz_check_bounds(ping->bounds_status, ping->bounds,
+							sxmin, sxmax, symin, symax) == MB_NO)
+						continue;
+					nselected = mbev_selected.num_soundings;
 					mbeditviz_apply_timelag(file, ping,
 								mbev_rollbias_3dsdg, mbev_pitchbias_3dsdg, mbev_headingbias_3dsdg, mbev_timelag_3dsdg,
 								&heading, &sonardepth,
@@ -3802,6 +3825,8 @@ mbev_selected.soundings[mbev_selected.num_soundings].z);*/
 								}
 							}
 						}
+					if (mbev_selected.num_soundings > nselected)
+						mbeditviz_ping_bounds(file, ping);
 					}
 				}
 			}
@@ -3966,6 +3991,7 @@ mbev_selected.soundings[mbev_selected.num_soundings].z);*/
 									mbev_selected.num_soundings_flagged++;
 								}
 							}
+						mbeditviz_ping_bounds(file, ping);
 						}
 					}
 
@@ -4298,6 +4324,21 @@ rollbias, pitchbias, headingbias, timelag);
 			}
 		}
 
+	/* update the bounds of the pings with moved soundings */
+	ifilelast = -1;
+	ipinglast = -1;
+	for (i=0;i<mbev_selected.num_soundings;i++)
+		{
+		ifile = mbev_selected.soundings[i].ifile;
+		iping = mbev_selected.soundings[i].iping;
+		if (ifile != ifilelast || iping != ipinglast)
+			{
+			mbeditviz_ping_bounds(&mbev_files[ifile], &(mbev_files[ifile].pings[iping]));
+			ifilelast = ifile;
+			ipinglast = iping;
+			}
+		}
+
 	/* get zscaling */
 	mbev_selected.zscale = mbev_selected.scale;
 	dz = zmax - zmin;
@@ -4363,6 +4404,7 @@ rollbias, pitchbias, headingbias, timelag);
 		file = &mbev_files[ifile];
 		if (file->load_status == MB_YES)
 			{
+			file->bounds_status = MBEV_BOUNDS_EMPTY;
 			for (iping=0;iping<file->num_pings;iping++)
 				{
 				ping = &(file->pings[iping]);
@@ -4387,6 +4429,7 @@ rollbias, pitchbias, headingbias, timelag);
 						&ping->bathx[ibeam], &ping->bathy[ibeam],
 						&mbev_error);
 					}
+				mbeditviz_ping_bounds(file, ping);
 				}
 			}
 		}
@@ -760,6 +760,95 @@ int mb_extract(int verbose, void *mbio_ptr, void *store_ptr,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mb_skip_ping(int verbose, void *mbio_ptr,
+		double time_d, double navlon, double navlat,
+		int *skip, int *error)
+{
+	char	*function_name = "mb_skip_ping";
+	int	status = MB_SUCCESS;
+	struct mb_io_struct *mb_io_ptr;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       mb_ptr:     %p\n",(void *)mbio_ptr);
+		fprintf(stderr,"dbg2       time_d:     %f\n",time_d);
+		fprintf(stderr,"dbg2       navlon:     %f\n",navlon);
+		fprintf(stderr,"dbg2       navlat:     %f\n",navlat);
+		}
+
+	/* get mbio descriptor */
+	mb_io_ptr = (struct mb_io_struct *) mbio_ptr;
+
+	/* a ping may only be skipped while being read by mb_read() or
+		mb_get(), which reject pings outside the location and
+		time bounds without using the beam data - projected
+		navigation is never skipped here */
+	*skip = MB_NO;
+	if (mb_io_ptr->skip_out_bounds == MB_YES
+		&& mb_io_ptr->projection_initialized == MB_NO)
+		{
+		/* apply lonflip as in mb_extract() */
+		if (mb_io_ptr->lonflip < 0)
+			{
+			if (navlon > 0.)
+				navlon = navlon - 360.;
+			else if (navlon < -360.)
+				navlon = navlon + 360.;
+			}
+		else if (mb_io_ptr->lonflip == 0)
+			{
+			if (navlon > 180.)
+				navlon = navlon - 360.;
+			else if (navlon < -180.)
+				navlon = navlon + 360.;
+			}
+		else
+			{
+			if (navlon > 360.)
+				navlon = navlon - 360.;
+			else if (navlon < 0.)
+				navlon = navlon + 360.;
+			}
+
+		/* check the bounds as in mb_read() */
+		if (navlon < mb_io_ptr->bounds[0]
+			|| navlon > mb_io_ptr->bounds[1]
+			|| navlat < mb_io_ptr->bounds[2]
+			|| navlat > mb_io_ptr->bounds[3])
+			*skip = MB_YES;
+		else if (mb_io_ptr->etime_d > mb_io_ptr->btime_d
+			&& time_d > MB_TIME_D_UNKNOWN
+			&& (time_d > mb_io_ptr->etime_d
+				|| time_d < mb_io_ptr->btime_d))
+			*skip = MB_YES;
+		else if (mb_io_ptr->etime_d < mb_io_ptr->btime_d
+			&& time_d > MB_TIME_D_UNKNOWN
+			&& (time_d > mb_io_ptr->etime_d
+				&& time_d < mb_io_ptr->btime_d))
+			*skip = MB_YES;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       skip:       %d\n",*skip);
+		fprintf(stderr,"dbg2       error:      %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:     %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 int mb_insert(int verbose, void *mbio_ptr, void *store_ptr,
 		int kind, int time_i[7], double time_d,
 		double navlon, double navlat,
@@ -210,8 +210,12 @@ int mb_buffer_init(int verbose, void **buff_ptr, int *error)
 
 	/* set nbuffer to zero */
 	buff->nbuffer = 0;
+	buff->npool = 0;
 	for (i=0;i<MB_BUFFER_MAX;i++)
+		{
 		buff->buffer[i] = NULL;
+		buff->pool[i] = NULL;
+		}
 
 	/* print output debug statements */
 	if (verbose >= 2)
@@ -264,6 +268,12 @@ int mb_buffer_close(int verbose, void **buff_ptr, void *mbio_ptr, int *error)
 				&buff->buffer[i],error);
 		}
 
+	/* deallocate the stores held for reuse */
+	for (i=0;i<buff->npool;i++)
+		status = mb_deall(verbose,mbio_ptr,
+			&buff->pool[i],error);
+	buff->npool = 0;
+
 	/* deallocate memory for data structure */
 	status = mb_free(verbose,buff_ptr,error);
 
@@ -282,6 +292,69 @@ int mb_buffer_close(int verbose, void **buff_ptr, void *mbio_ptr, int *error)
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mb_buffer_release(int verbose, void *buff_ptr, void *mbio_ptr,
+		void **store_ptr, int *error)
+{
+	char	*function_name = "mb_buffer_release";
+	int	status = MB_SUCCESS;
+	struct mb_buffer_struct *buff;
+	struct mb_io_struct *mb_io_ptr;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       buff_ptr:   %p\n",(void *)buff_ptr);
+		fprintf(stderr,"dbg2       mbio_ptr:   %p\n",(void *)mbio_ptr);
+		fprintf(stderr,"dbg2       store_ptr:  %p\n",(void *)*store_ptr);
+		}
+
+	/* get buffer structure */
+	buff = (struct mb_buffer_struct *) buff_ptr;
+	mb_io_ptr = (struct mb_io_struct *) mbio_ptr;
+
+	/* a store can only be reused as a copy destination if the format
+		copy function keeps or frees the arrays already held by the
+		destination - many copy functions start with *copy = *store
+		and allocate fresh arrays, which would leak those of a reused
+		store, so all other stores are deallocated as before */
+	if (*store_ptr != NULL
+		&& buff->npool < MB_BUFFER_MAX
+		&& (mb_io_ptr->system == MB_SYS_LDEOIH
+			|| mb_io_ptr->system == MB_SYS_GSF
+			|| mb_io_ptr->system == MB_SYS_RESON7K
+			|| mb_io_ptr->system == MB_SYS_SWATHPLUS
+			|| mb_io_ptr->system == MB_SYS_WASSP))
+		{
+		buff->pool[buff->npool] = *store_ptr;
+		buff->npool++;
+		*store_ptr = NULL;
+		}
+	else if (*store_ptr != NULL)
+		{
+		status = mb_deall(verbose,mbio_ptr,store_ptr,error);
+		*store_ptr = NULL;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       npool:      %d\n",buff->npool);
+		fprintf(stderr,"dbg2       error:      %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:     %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 int mb_buffer_load(int verbose, void *buff_ptr,void *mbio_ptr,
 		    int nwant, int *nload, int *nbuff, int *error)
 {
@@ -292,6 +365,7 @@ int mb_buffer_load(int verbose, void *buff_ptr,void *mbio_ptr,
 	char	*store_ptr;
 	int	nget;
 	int	kind;
+	int	error_release;
 	int	i;
 
 	/* print input debug statements */
@@ -368,10 +442,22 @@ int mb_buffer_load(int verbose, void *buff_ptr,void *mbio_ptr,
 		if (*error == MB_ERROR_NO_ERROR && store_ptr != NULL)
 			{
 
-			/* allocate space and copy the data */
-			status = mb_alloc(verbose,mbio_ptr,
-				&buff->buffer[buff->nbuffer],
-				error);
+			/* get space for the record, reusing a previously dumped
+				store if available - only stores of formats whose copy
+				functions reuse the arrays already allocated in the
+				destination are kept (see mb_buffer_release()) */
+			if (buff->npool > 0)
+				{
+				buff->npool--;
+				buff->buffer[buff->nbuffer] = buff->pool[buff->npool];
+				buff->pool[buff->npool] = NULL;
+				}
+			else
+				status = mb_alloc(verbose,mbio_ptr,
+					&buff->buffer[buff->nbuffer],
+					error);
+
+			/* copy the data */
 			if (status == MB_SUCCESS)
 			status = mb_copyrecord(verbose,mbio_ptr,
 				store_ptr,
@@ -382,6 +468,11 @@ int mb_buffer_load(int verbose, void *buff_ptr,void *mbio_ptr,
 				buff->nbuffer++;
 				(*nload)++;
 				}
+			else if (buff->buffer[buff->nbuffer] != NULL)
+				{
+				mb_buffer_release(verbose,buff_ptr,mbio_ptr,
+					&buff->buffer[buff->nbuffer],&error_release);
+				}
 			}
 
 		/* print debug statements */
@@ -520,15 +611,15 @@ int mb_buffer_dump(int verbose, void *buff_ptr, void *mbio_ptr, void *ombio_ptr,
 			/* print debug statements */
 			if (verbose >= 4)
 				{
-				fprintf(stderr,"\ndbg4  Deallocating record in MBIO function <%s>\n",function_name);
+				fprintf(stderr,"\ndbg4  Releasing record in MBIO function <%s>\n",function_name);
 				fprintf(stderr,"dbg4       record:      %d\n",i);
 				fprintf(stderr,"dbg4       ptr:         %p\n",(void *)buff->buffer[i]);
 				fprintf(stderr,"dbg4       kind:        %d\n",buff->buffer_kind[i]);
 				}
 
-			status = mb_deall(verbose,mbio_ptr,
+			/* keep the store for reuse if the format allows */
+			status = mb_buffer_release(verbose,buff_ptr,mbio_ptr,
 				&buff->buffer[i],error);
-			buff->buffer[i] = NULL;
 
 			/* print debug statements */
 			if (verbose >= 4)
@@ -670,15 +761,15 @@ int mb_buffer_clear(int verbose, void *buff_ptr, void *mbio_ptr,
 			/* print debug statements */
 			if (verbose >= 4)
 				{
-				fprintf(stderr,"\ndbg4  Deallocating record in MBIO function <%s>\n",function_name);
+				fprintf(stderr,"\ndbg4  Releasing record in MBIO function <%s>\n",function_name);
 				fprintf(stderr,"dbg4       record:      %d\n",i);
 				fprintf(stderr,"dbg4       ptr:         %p\n",(void *)buff->buffer[i]);
 				fprintf(stderr,"dbg4       kind:        %d\n",buff->buffer_kind[i]);
 				}
 
-			status = mb_deall(verbose,mbio_ptr,
+			/* keep the store for reuse if the format allows */
+			status = mb_buffer_release(verbose,buff_ptr,mbio_ptr,
 				&buff->buffer[i],error);
-			buff->buffer[i] = NULL;
 
 			/* print debug statements */
 			if (verbose >= 4)
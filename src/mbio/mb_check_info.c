@@ -892,10 +892,26 @@ int mb_make_info(int verbose, int force,
 	    && format != MBF_NVNETCDF
 	    && format != MBF_MBPRONAV)
 		{
+		/* if a current fbt file exists list the navigation from it
+			rather than decoding the original swath file again - the
+			fbt file holds the same pings, navigation, attitude and beams */
+		fbtmodtime = 0;
+		if ((fstat = stat(fbtfile, &file_status)) == 0
+			&& (file_status.st_mode & S_IFMT) != S_IFDIR
+			&& file_status.st_size  > 0)
+			{
+			fbtmodtime = file_status.st_mtime;
+			}
 		if (verbose >= 1)
 			fprintf(stderr,"Generating fnv file for %s\n",file);
-		sprintf(command, "mblist -F %d -I %s -O tMXYHScRPr=X=Y+X+Y -UN > %s.fnv",
-			format, file, file);
+		if (fbtmodtime > 0 && fbtmodtime >= datmodtime)
+			sprintf(command, "mblist -F 71 -I %s -O tMXYHScRPr=X=Y+X+Y -UN > %s.fnv",
+				fbtfile, file);
+		else
+			sprintf(command, "mblist -F %d -I %s -O tMXYHScRPr=X=Y+X+Y -UN > %s.fnv",
+				format, file, file);
+		if (verbose >= 2)
+			fprintf(stderr,"\t%s\n",command);
 		shellstatus = system(command);
 		}
 
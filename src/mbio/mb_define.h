@@ -397,6 +397,9 @@ int mb_extract(int verbose, void *mbio_ptr, void *store_ptr,
 		double *bathacrosstrack, double *bathalongtrack,
 		double *ss, double *ssacrosstrack, double *ssalongtrack,
 		char *comment, int *error);
+int mb_skip_ping(int verbose, void *mbio_ptr,
+		double time_d, double navlon, double navlat,
+		int *skip, int *error);
 int mb_insert(int verbose, void *mbio_ptr, void *store_ptr,
 		int kind, int time_i[7], double time_d,
 		double navlon, double navlat,
@@ -497,6 +500,8 @@ int mb_copyrecord(int verbose, void *mbio_ptr,
 int mb_buffer_init(int verbose, void **buff_ptr, int *error);
 int mb_buffer_close(int verbose, void **buff_ptr, void *mbio_ptr,
 		int *error);
+int mb_buffer_release(int verbose, void *buff_ptr, void *mbio_ptr,
+		void **store_ptr, int *error);
 int mb_buffer_load(int verbose, void *buff_ptr,void *mbio_ptr,
 		int nwant, int *nload, int *nbuff, int *error);
 int mb_buffer_dump(int verbose, void *buff_ptr, void *mbio_ptr, void *ombio_ptr,
@@ -739,6 +744,18 @@ int mb_proj_inverse(int verbose,
 		double easting, double northing,
 		double *lon, double *lat,
 		int *error);
+int mb_proj_forward_array(int verbose,
+		void *pjptr,
+		int npoint,
+		double *lon, double *lat,
+		double *easting, double *northing,
+		int *error);
+int mb_proj_inverse_array(int verbose,
+		void *pjptr,
+		int npoint,
+		double *easting, double *northing,
+		double *lon, double *lat,
+		int *error);
 int mb_proj_transform(int verbose,
 		void *pjsrcptr,
 		void *pjdstptr,
@@ -174,6 +174,16 @@ struct mb_io_struct
 					in km/hr */
 	double	timegap;	/* maximum time between pings without
 					a data gap */
+	int	skip_out_bounds; /* if true then a format may skip the
+					beam data of pings outside the
+					location and time bounds - see
+					mb_skip_ping() */
+	int	scan_ancillary; /* if true then a format may skip the
+					beam, sidescan and water column
+					payloads of survey pings - used by
+					preprocessing passes that only need
+					navigation, attitude, heading and
+					sonar depth */
 
 	/* file descriptor, file name, and usage flag */
 	FILE	*mbfp;		/* file descriptor */
@@ -511,6 +521,8 @@ struct mb_buffer_struct
 	void *buffer[MB_BUFFER_MAX];
 	int buffer_kind[MB_BUFFER_MAX];
 	int nbuffer;
+	void *pool[MB_BUFFER_MAX];	/* dumped stores kept for reuse */
+	int npool;
 	};
 
 /* MBIO datalist control structure */
@@ -6069,3 +6069,188 @@ int mb_pr_unlockswathfile(int verbose, char *file, int purpose,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mb_pr_readcache(int verbose, char *file, int key,
+			int ncolumn, int *nrecord, double **columns[],
+			int *info, int *error)
+{
+	char	*function_name = "mb_pr_readcache";
+	int	status = MB_SUCCESS;
+	mb_path	cachefile;
+	FILE	*fp;
+	int	header[6];
+	long	source[2];
+	int	i, j;
+
+	/* file status variables */
+	struct stat file_status;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       file:       %s\n",file);
+		fprintf(stderr,"dbg2       key:        %d\n",key);
+		fprintf(stderr,"dbg2       ncolumn:    %d\n",ncolumn);
+		fprintf(stderr,"dbg2       columns:    %p\n",(void *)columns);
+		}
+
+	/* the cache is only used if it was made from a source file of the
+		same size and modification time, parsed with the same key -
+		the header also catches caches written with another byte order */
+	*nrecord = 0;
+	*info = 0;
+	status = MB_FAILURE;
+	*error = MB_ERROR_OPEN_FAIL;
+	sprintf(cachefile, "%s%s", file, MBP_CACHE_SUFFIX);
+	if (ncolumn > 0 && ncolumn <= MBP_CACHE_NCOLUMN_MAX
+		&& stat(file, &file_status) == 0
+		&& (fp = fopen(cachefile, "rb")) != NULL)
+		{
+		if (fread(header, sizeof(int), 6, fp) == 6
+			&& fread(source, sizeof(long), 2, fp) == 2
+			&& strncmp((char *)&header[0], "MBPC", 4) == 0
+			&& header[1] == MBP_CACHE_VERSION
+			&& header[2] == key
+			&& header[3] == ncolumn
+			&& header[4] > 0
+			&& source[0] == (long) file_status.st_size
+			&& source[1] == (long) file_status.st_mtime)
+			{
+			*nrecord = header[4];
+			*info = header[5];
+			status = MB_SUCCESS;
+			*error = MB_ERROR_NO_ERROR;
+			}
+
+		/* allocate and read the columns */
+		for (i=0;i<ncolumn && status == MB_SUCCESS;i++)
+			{
+			status = mb_mallocd(verbose,__FILE__,__LINE__,(*nrecord)*sizeof(double),(void **)columns[i],error);
+			if (status == MB_SUCCESS
+				&& fread(*columns[i], sizeof(double), *nrecord, fp) != *nrecord)
+				{
+				status = MB_FAILURE;
+				*error = MB_ERROR_EOF;
+				}
+			if (status == MB_FAILURE)
+				{
+				for (j=0;j<=i;j++)
+					mb_freed(verbose,__FILE__,__LINE__,(void **)columns[j],error);
+				*nrecord = 0;
+				*error = MB_ERROR_EOF;
+				}
+			}
+		fclose(fp);
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       nrecord:    %d\n",*nrecord);
+		fprintf(stderr,"dbg2       info:       %d\n",*info);
+		fprintf(stderr,"dbg2       error:      %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:     %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mb_pr_writecache(int verbose, char *file, int key,
+			int ncolumn, int nrecord, double *columns[],
+			int info, int *error)
+{
+	char	*function_name = "mb_pr_writecache";
+	int	status = MB_SUCCESS;
+	mb_path	cachefile;
+	mb_path	tmpfile;
+	FILE	*fp;
+	int	header[6];
+	long	source[2];
+	int	i;
+
+	/* file status variables */
+	struct stat file_status;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       file:       %s\n",file);
+		fprintf(stderr,"dbg2       key:        %d\n",key);
+		fprintf(stderr,"dbg2       ncolumn:    %d\n",ncolumn);
+		fprintf(stderr,"dbg2       nrecord:    %d\n",nrecord);
+		fprintf(stderr,"dbg2       columns:    %p\n",(void *)columns);
+		fprintf(stderr,"dbg2       info:       %d\n",info);
+		}
+
+	/* write the cache to a temporary file that is renamed when complete,
+		so that concurrent mbprocess runs never see a partial cache -
+		failure to write it (e.g. in a read-only directory) should not
+		be treated as fatal by the caller */
+	sprintf(cachefile, "%s%s", file, MBP_CACHE_SUFFIX);
+	sprintf(tmpfile, "%s%s.%d", file, MBP_CACHE_SUFFIX, getpid());
+	if (ncolumn > 0 && ncolumn <= MBP_CACHE_NCOLUMN_MAX
+		&& nrecord > 0
+		&& stat(file, &file_status) == 0
+		&& (fp = fopen(tmpfile, "wb")) != NULL)
+		{
+		strncpy((char *)&header[0], "MBPC", 4);
+		header[1] = MBP_CACHE_VERSION;
+		header[2] = key;
+		header[3] = ncolumn;
+		header[4] = nrecord;
+		header[5] = info;
+		source[0] = (long) file_status.st_size;
+		source[1] = (long) file_status.st_mtime;
+		if (fwrite(header, sizeof(int), 6, fp) != 6
+			|| fwrite(source, sizeof(long), 2, fp) != 2)
+			status = MB_FAILURE;
+		for (i=0;i<ncolumn && status == MB_SUCCESS;i++)
+			{
+			if (fwrite(columns[i], sizeof(double), nrecord, fp) != nrecord)
+				status = MB_FAILURE;
+			}
+		if (fclose(fp) != 0)
+			status = MB_FAILURE;
+
+		/* do not leave a partial cache behind */
+		if (status == MB_SUCCESS && rename(tmpfile, cachefile) != 0)
+			status = MB_FAILURE;
+		if (status == MB_FAILURE)
+			{
+			remove(tmpfile);
+			*error = MB_ERROR_WRITE_FAIL;
+			}
+		}
+	else
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:      %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:     %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
@@ -682,6 +682,14 @@
 #define MBP_UNLOCK_PROCESS	1
 #define MBP_UNLOCK_EDITBATHY	2
 #define MBP_UNLOCK_EDITNAV	3
+#define MBP_CACHE_SUFFIX	".mbc"
+#define MBP_CACHE_VERSION	1
+#define MBP_CACHE_NCOLUMN_MAX	16
+#define MBP_CACHE_KEY_NAV	0
+#define MBP_CACHE_KEY_NAVADJ	100000
+#define MBP_CACHE_KEY_ATTITUDE	200000
+#define MBP_CACHE_KEY_SONARDEPTH	300000
+#define MBP_CACHE_KEY_TIDE	400000
 
 /* mbprocess file checking */
 #define MB_PR_FILE_UP_TO_DATE		0
@@ -1276,6 +1284,12 @@ int mb_pr_unlockswathfile(int verbose, char *file, int purpose,
 int mb_pr_lockinfo(int verbose, char *file, int *locked,
 			int *purpose, char *program, char *user, char *cpu,
 			char *date, int *error);
+int mb_pr_readcache(int verbose, char *file, int key,
+			int ncolumn, int *nrecord, double **columns[],
+			int *info, int *error);
+int mb_pr_writecache(int verbose, char *file, int key,
+			int ncolumn, int nrecord, double *columns[],
+			int info, int *error);
 
 /* end this include */
 #endif
@@ -19,6 +19,11 @@
  * between geographic coordinates (longitude and latitude) and
  * projected coordinates (e.g. eastings and northings in meters).
  * One can also tranlate between coordinate systems using mb_proj_transform().
+ * Whole arrays of points can be projected with mb_proj_forward_array()
+ * and mb_proj_inverse_array(). Transverse Mercator and UTM projections
+ * on an ellipsoid are evaluated by a built in kernel that uses the same
+ * series as libproj with the projection constants precomputed, and all
+ * other projections are passed to libproj.
  * This code uses libproj. The code in libproj derives without modification
  * from the PROJ.4 distribution. PROJ was originally developed by
  * Gerard Evandim, and is now maintained and distributed by
@@ -37,6 +42,8 @@
 
 /* standard include files */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <sys/stat.h>
 
@@ -48,6 +55,53 @@
 
 static char rcs_id[]="$Id$";
 
+/* transverse Mercator series coefficients as used by libproj */
+#define MB_PROJ_FC1	1.
+#define MB_PROJ_FC2	.5
+#define MB_PROJ_FC3	.16666666666666666666
+#define MB_PROJ_FC4	.08333333333333333333
+#define MB_PROJ_FC5	.05
+#define MB_PROJ_FC6	.03333333333333333333
+#define MB_PROJ_FC7	.02380952380952380952
+#define MB_PROJ_FC8	.01785714285714285714
+#define MB_PROJ_SPI	3.14159265359
+#define MB_PROJ_EPS	1.0e-12
+#define MB_PROJ_MLFN_EPS	1.0e-11
+#define MB_PROJ_MLFN_ITER	10
+
+/* the built in transverse Mercator kernel must reproduce libproj to
+	within these tolerances (meters, degrees) at initialization */
+#define MB_PROJ_CHECK_XY	0.0001
+#define MB_PROJ_CHECK_LL	0.000000001
+
+/* the projection handle returned by mb_proj_init() - the libproj
+	projection plus the constants of the built in transverse Mercator
+	kernel when it applies */
+struct mb_proj_struct
+	{
+	projPJ	pj;
+	int	tm;
+	double	a;
+	double	ra;
+	double	es;
+	double	esp;
+	double	k0;
+	double	lam0;
+	double	phi0;
+	double	x0;
+	double	y0;
+	double	to_meter;
+	double	fr_meter;
+	double	ml0;
+	double	en[5];
+	};
+
+static int mb_proj_tm_init(int verbose, struct mb_proj_struct *proj);
+static void mb_proj_tm_forward(struct mb_proj_struct *proj, int npoint,
+		double *lon, double *lat, double *easting, double *northing);
+static void mb_proj_tm_inverse(struct mb_proj_struct *proj, int npoint,
+		double *easting, double *northing, double *lon, double *lat);
+
 /*--------------------------------------------------------------------*/
 int mb_proj_init(int verbose,
 		char *projection,
@@ -58,6 +112,7 @@ int mb_proj_init(int verbose,
 	int	status = MB_SUCCESS;
 	char 	pj_init_args[MB_PATH_MAXLINE];
 	projPJ 	pj;
+	struct mb_proj_struct *proj;
 	struct stat file_status;
 	int	fstat;
 
@@ -79,13 +134,23 @@ int mb_proj_init(int verbose,
 		sprintf(pj_init_args, "+init=%s:%s",
 				projectionfile,projection);
 		pj = pj_init_plus(pj_init_args);
-		*pjptr = (void *) pj;
+		*pjptr = NULL;
 
 		/* check success */
-		if (*pjptr != NULL)
+		if (pj != NULL)
 			{
-			*error = MB_ERROR_NO_ERROR;
-			status = MB_SUCCESS;
+			status = mb_mallocd(verbose, __FILE__, __LINE__,
+					sizeof(struct mb_proj_struct), (void **)&proj, error);
+			if (status == MB_SUCCESS)
+				{
+				memset(proj, 0, sizeof(struct mb_proj_struct));
+				proj->pj = pj;
+				mb_proj_tm_init(verbose, proj);
+				*pjptr = (void *) proj;
+				*error = MB_ERROR_NO_ERROR;
+				}
+			else
+				pj_free(pj);
 			}
 		else
 			{
@@ -125,7 +190,7 @@ int mb_proj_free(int verbose,
 {
 	char	*function_name = "mb_proj_free";
 	int	status = MB_SUCCESS;
-	projPJ 	pj;
+	struct mb_proj_struct *proj;
 
 	/* print input debug statements */
 	if (verbose >= 2)
@@ -138,10 +203,11 @@ int mb_proj_free(int verbose,
 		}
 
 	/* free the projection */
-	if (pjptr != NULL)
+	if (pjptr != NULL && *pjptr != NULL)
 		{
-		pj = (projPJ) *pjptr;
-		pj_free(pj);
+		proj = (struct mb_proj_struct *) *pjptr;
+		pj_free(proj->pj);
+		mb_freed(verbose, __FILE__, __LINE__, (void **)pjptr, error);
 		*pjptr = NULL;
 		}
 
@@ -173,7 +239,7 @@ int mb_proj_forward(int verbose,
 {
 	char	*function_name = "mb_proj_forward";
 	int	status = MB_SUCCESS;
-	projPJ 	pj;
+	struct mb_proj_struct *proj;
 	projUV	pjxy;
 	projUV	pjll;
 
@@ -192,12 +258,19 @@ int mb_proj_forward(int verbose,
 	/* do forward projection */
 	if (pjptr != NULL)
 		{
-		pj = (projPJ) pjptr;
-		pjll.u = DTR * lon;
-		pjll.v = DTR * lat;
-		pjxy = pj_fwd(pjll, pj);
-		*easting = pjxy.u;
-		*northing = pjxy.v;
+		proj = (struct mb_proj_struct *) pjptr;
+		if (proj->tm == MB_YES)
+			{
+			mb_proj_tm_forward(proj, 1, &lon, &lat, easting, northing);
+			}
+		else
+			{
+			pjll.u = DTR * lon;
+			pjll.v = DTR * lat;
+			pjxy = pj_fwd(pjll, proj->pj);
+			*easting = pjxy.u;
+			*northing = pjxy.v;
+			}
 		}
 
 	/* assume success */
@@ -229,7 +302,7 @@ int mb_proj_inverse(int verbose,
 {
 	char	*function_name = "mb_proj_inverse";
 	int	status = MB_SUCCESS;
-	projPJ 	pj;
+	struct mb_proj_struct *proj;
 	projUV	pjxy;
 	projUV	pjll;
 
@@ -245,15 +318,22 @@ int mb_proj_inverse(int verbose,
 		fprintf(stderr,"dbg2       northing:   %f\n",northing);
 		}
 
-	/* do forward projection */
+	/* do inverse projection */
 	if (pjptr != NULL)
 		{
-		pj = (projPJ) pjptr;
-		pjxy.u = easting;
-		pjxy.v = northing;
-		pjll = pj_inv(pjxy, pj);
-		*lon = RTD * pjll.u;
-		*lat = RTD * pjll.v;
+		proj = (struct mb_proj_struct *) pjptr;
+		if (proj->tm == MB_YES)
+			{
+			mb_proj_tm_inverse(proj, 1, &easting, &northing, lon, lat);
+			}
+		else
+			{
+			pjxy.u = easting;
+			pjxy.v = northing;
+			pjll = pj_inv(pjxy, proj->pj);
+			*lon = RTD * pjll.u;
+			*lat = RTD * pjll.v;
+			}
 		}
 
 	/* assume success */
@@ -277,6 +357,150 @@ int mb_proj_inverse(int verbose,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mb_proj_forward_array(int verbose,
+		void *pjptr,
+		int npoint,
+		double *lon, double *lat,
+		double *easting, double *northing,
+		int *error)
+{
+	char	*function_name = "mb_proj_forward_array";
+	int	status = MB_SUCCESS;
+	struct mb_proj_struct *proj;
+	projUV	pjxy;
+	projUV	pjll;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       pjptr:      %p\n",(void *)pjptr);
+		fprintf(stderr,"dbg2       npoint:     %d\n",npoint);
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  lon:%f lat:%f\n", i, lon[i], lat[i]);
+		}
+
+	/* do forward projection of all points - the output arrays
+		may be the same as the input arrays - transverse Mercator
+		projections use the built in kernel and all others go
+		through libproj one point at a time */
+	if (pjptr != NULL)
+		{
+		proj = (struct mb_proj_struct *) pjptr;
+		if (proj->tm == MB_YES)
+			{
+			mb_proj_tm_forward(proj, npoint, lon, lat, easting, northing);
+			}
+		else
+			{
+			for (i=0;i<npoint;i++)
+				{
+				pjll.u = DTR * lon[i];
+				pjll.v = DTR * lat[i];
+				pjxy = pj_fwd(pjll, proj->pj);
+				easting[i] = pjxy.u;
+				northing[i] = pjxy.v;
+				}
+			}
+		}
+
+	/* assume success */
+	*error = MB_ERROR_NO_ERROR;
+	status = MB_SUCCESS;
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  easting:%f northing:%f\n", i, easting[i], northing[i]);
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mb_proj_inverse_array(int verbose,
+		void *pjptr,
+		int npoint,
+		double *easting, double *northing,
+		double *lon, double *lat,
+		int *error)
+{
+	char	*function_name = "mb_proj_inverse_array";
+	int	status = MB_SUCCESS;
+	struct mb_proj_struct *proj;
+	projUV	pjxy;
+	projUV	pjll;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:    %d\n",verbose);
+		fprintf(stderr,"dbg2       pjptr:      %p\n",(void *)pjptr);
+		fprintf(stderr,"dbg2       npoint:     %d\n",npoint);
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  easting:%f northing:%f\n", i, easting[i], northing[i]);
+		}
+
+	/* do inverse projection of all points - the output arrays
+		may be the same as the input arrays - transverse Mercator
+		projections use the built in kernel and all others go
+		through libproj one point at a time */
+	if (pjptr != NULL)
+		{
+		proj = (struct mb_proj_struct *) pjptr;
+		if (proj->tm == MB_YES)
+			{
+			mb_proj_tm_inverse(proj, npoint, easting, northing, lon, lat);
+			}
+		else
+			{
+			for (i=0;i<npoint;i++)
+				{
+				pjxy.u = easting[i];
+				pjxy.v = northing[i];
+				pjll = pj_inv(pjxy, proj->pj);
+				lon[i] = RTD * pjll.u;
+				lat[i] = RTD * pjll.v;
+				}
+			}
+		}
+
+	/* assume success */
+	*error = MB_ERROR_NO_ERROR;
+	status = MB_SUCCESS;
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  lon:%f lat:%f\n", i, lon[i], lat[i]);
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 int mb_proj_transform(int verbose,
 		void *pjsrcptr,
 		void *pjdstptr,
@@ -306,7 +530,9 @@ int mb_proj_transform(int verbose,
 	/* do transform */
 	if (pjsrcptr != NULL && pjdstptr != NULL)
 		{
-		pj_transform((projPJ *)pjsrcptr, (projPJ *)pjdstptr, npoint, 1, x, y, z);
+		pj_transform(((struct mb_proj_struct *)pjsrcptr)->pj,
+				((struct mb_proj_struct *)pjdstptr)->pj,
+				npoint, 1, x, y, z);
 		}
 
 	/* assume success */
@@ -331,3 +557,325 @@ int mb_proj_transform(int verbose,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+/*
+ * Gets the value of a +name=value parameter from a libproj definition
+ * string, returning MB_NO if the parameter is not present.
+ */
+static int mb_proj_def_param(char *def, char *name, char *value)
+{
+	char	key[32];
+	char	*ptr;
+	int	n;
+
+	sprintf(key, "+%s", name);
+	n = strlen(key);
+	for (ptr = strstr(def, key); ptr != NULL; ptr = strstr(ptr + n, key))
+		{
+		if ((ptr == def || ptr[-1] == ' ')
+			&& (ptr[n] == '=' || ptr[n] == ' ' || ptr[n] == '\0'))
+			{
+			value[0] = '\0';
+			if (ptr[n] == '=')
+				sscanf(&ptr[n+1], "%31s", value);
+			return(MB_YES);
+			}
+		}
+	return(MB_NO);
+}
+/*--------------------------------------------------------------------*/
+/*
+ * Sets up the built in transverse Mercator kernel if the projection is
+ * an ellipsoidal tmerc or utm projection with plain metric parameters.
+ * The kernel is only used if it reproduces libproj for a set of points
+ * across the zone, so anything not understood here (e.g. angles given
+ * in degrees-minutes-seconds) falls back to libproj.
+ */
+static int mb_proj_tm_init(int verbose, struct mb_proj_struct *proj)
+{
+	char	*def;
+	char	value[32];
+	double	es, t;
+	double	lon[2], lat[2], x[2], y[2];
+	projUV	pjxy;
+	projUV	pjll;
+	int	zone;
+	int	i, j;
+
+	proj->tm = MB_NO;
+	if ((def = pj_get_def(proj->pj, 0)) == NULL)
+		return(MB_FAILURE);
+
+	/* only ellipsoidal transverse Mercator without unusual options */
+	pj_get_spheroid_defn(proj->pj, &proj->a, &es);
+	if (es > 0.0
+		&& mb_proj_def_param(def, "proj", value) == MB_YES
+		&& (strcmp(value, "utm") == 0 || strcmp(value, "tmerc") == 0)
+		&& mb_proj_def_param(def, "geoc", value) == MB_NO
+		&& mb_proj_def_param(def, "over", value) == MB_NO
+		&& mb_proj_def_param(def, "axis", value) == MB_NO
+		&& (mb_proj_def_param(def, "units", value) == MB_NO
+			|| strcmp(value, "m") == 0))
+		{
+		proj->tm = MB_YES;
+		proj->es = es;
+		proj->ra = 1.0 / proj->a;
+		proj->esp = es / (1.0 - es);
+		proj->to_meter = 1.0;
+		if (mb_proj_def_param(def, "to_meter", value) == MB_YES)
+			proj->to_meter = atof(value);
+		if (proj->to_meter <= 0.0)
+			proj->tm = MB_NO;
+		proj->fr_meter = 1.0 / proj->to_meter;
+		mb_proj_def_param(def, "proj", value);
+		if (strcmp(value, "utm") == 0)
+			{
+			if (mb_proj_def_param(def, "zone", value) == MB_YES)
+				{
+				zone = atoi(value) - 1;
+				if (zone < 0 || zone >= 60)
+					proj->tm = MB_NO;
+				}
+			else
+				{
+				t = 0.0;
+				if (mb_proj_def_param(def, "lon_0", value) == MB_YES)
+					t = DTR * atof(value);
+				if (fabs(t) > MB_PROJ_SPI)
+					t -= 2.0 * M_PI * floor((t + M_PI) / (2.0 * M_PI));
+				zone = floor((t + M_PI) * 30.0 / M_PI);
+				zone = MIN(MAX(zone, 0), 59);
+				}
+			proj->lam0 = (zone + 0.5) * M_PI / 30.0 - M_PI;
+			proj->phi0 = 0.0;
+			proj->k0 = 0.9996;
+			proj->x0 = 500000.0;
+			proj->y0 = (mb_proj_def_param(def, "south", value) == MB_YES ? 10000000.0 : 0.0);
+			}
+		else
+			{
+			proj->lam0 = 0.0;
+			proj->phi0 = 0.0;
+			proj->k0 = 1.0;
+			proj->x0 = 0.0;
+			proj->y0 = 0.0;
+			if (mb_proj_def_param(def, "lon_0", value) == MB_YES)
+				proj->lam0 = DTR * atof(value);
+			if (mb_proj_def_param(def, "lat_0", value) == MB_YES)
+				proj->phi0 = DTR * atof(value);
+			if (mb_proj_def_param(def, "k_0", value) == MB_YES
+				|| mb_proj_def_param(def, "k", value) == MB_YES)
+				proj->k0 = atof(value);
+			if (mb_proj_def_param(def, "x_0", value) == MB_YES)
+				proj->x0 = atof(value);
+			if (mb_proj_def_param(def, "y_0", value) == MB_YES)
+				proj->y0 = atof(value);
+			}
+
+		/* meridional distance coefficients as in pj_enfn() */
+		proj->en[0] = 1.0 - es * (.25 + es * (.046875 + es * (.01953125 + es * .01068115234375)));
+		proj->en[1] = es * (.75 - es * (.046875 + es * (.01953125 + es * .01068115234375)));
+		t = es * es;
+		proj->en[2] = t * (.46875 - es * (.01302083333333333333 + es * .00712076822916666666));
+		t *= es;
+		proj->en[3] = t * (.36458333333333333333 - es * .00569661458333333333);
+		proj->en[4] = t * es * .3076171875;
+		t = sin(proj->phi0) * cos(proj->phi0);
+		proj->ml0 = proj->en[0] * proj->phi0 - t * (proj->en[1] + sin(proj->phi0) * sin(proj->phi0)
+				* (proj->en[2] + sin(proj->phi0) * sin(proj->phi0)
+				* (proj->en[3] + sin(proj->phi0) * sin(proj->phi0) * proj->en[4])));
+		}
+	pj_dalloc(def);
+
+	/* check the kernel against libproj across the zone */
+	for (i=-3;i<=3 && proj->tm == MB_YES;i++)
+		for (j=-8;j<=8 && proj->tm == MB_YES;j++)
+			{
+			lon[0] = RTD * proj->lam0 + 1.2 * i;
+			lat[0] = 10.0 * j;
+			pjll.u = DTR * lon[0];
+			pjll.v = DTR * lat[0];
+			pjxy = pj_fwd(pjll, proj->pj);
+			mb_proj_tm_forward(proj, 1, &lon[0], &lat[0], &x[0], &y[0]);
+			pjll = pj_inv(pjxy, proj->pj);
+			mb_proj_tm_inverse(proj, 1, &pjxy.u, &pjxy.v, &lon[1], &lat[1]);
+			if (pjxy.u == HUGE_VAL || pjll.u == HUGE_VAL
+				|| fabs(x[0] - pjxy.u) > MB_PROJ_CHECK_XY
+				|| fabs(y[0] - pjxy.v) > MB_PROJ_CHECK_XY
+				|| fabs(lon[1] - RTD * pjll.u) > MB_PROJ_CHECK_LL
+				|| fabs(lat[1] - RTD * pjll.v) > MB_PROJ_CHECK_LL)
+				proj->tm = MB_NO;
+			}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n","mb_proj_tm_init");
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       tm:              %d\n",proj->tm);
+		if (proj->tm == MB_YES)
+			{
+			fprintf(stderr,"dbg2       a:               %f\n",proj->a);
+			fprintf(stderr,"dbg2       es:              %f\n",proj->es);
+			fprintf(stderr,"dbg2       k0:              %f\n",proj->k0);
+			fprintf(stderr,"dbg2       lon0:            %f\n",RTD * proj->lam0);
+			fprintf(stderr,"dbg2       lat0:            %f\n",RTD * proj->phi0);
+			fprintf(stderr,"dbg2       x0:              %f\n",proj->x0);
+			fprintf(stderr,"dbg2       y0:              %f\n",proj->y0);
+			}
+		}
+
+	return(MB_SUCCESS);
+}
+/*--------------------------------------------------------------------*/
+/*
+ * Forward ellipsoidal transverse Mercator projection of an array of
+ * points, following pj_fwd() and the tmerc projection of libproj with
+ * all constants taken from the projection structure. The output arrays
+ * may be the same as the input arrays.
+ */
+static void mb_proj_tm_forward(struct mb_proj_struct *proj, int npoint,
+		double *lon, double *lat, double *easting, double *northing)
+{
+	double	lam, phi, t, al, als, n, cosphi, sinphi, ml, x, y;
+	double	*en = proj->en;
+	int	i;
+
+	for (i=0;i<npoint;i++)
+		{
+		lam = DTR * lon[i];
+		phi = DTR * lat[i];
+		t = fabs(phi) - M_PI_2;
+		if (t > MB_PROJ_EPS || fabs(lam) > 10.0)
+			{
+			easting[i] = HUGE_VAL;
+			northing[i] = HUGE_VAL;
+			continue;
+			}
+		if (fabs(t) <= MB_PROJ_EPS)
+			phi = (phi < 0.0 ? -M_PI_2 : M_PI_2);
+		lam -= proj->lam0;
+		if (fabs(lam) > MB_PROJ_SPI)
+			{
+			lam += M_PI;
+			lam -= 2.0 * M_PI * floor(lam / (2.0 * M_PI));
+			lam -= M_PI;
+			}
+		if (lam < -M_PI_2 || lam > M_PI_2)
+			{
+			easting[i] = HUGE_VAL;
+			northing[i] = HUGE_VAL;
+			continue;
+			}
+
+		sinphi = sin(phi);
+		cosphi = cos(phi);
+		t = (fabs(cosphi) > 1e-10 ? sinphi / cosphi : 0.0);
+		t *= t;
+		al = cosphi * lam;
+		als = al * al;
+		al /= sqrt(1.0 - proj->es * sinphi * sinphi);
+		n = proj->esp * cosphi * cosphi;
+		ml = en[0] * phi - sinphi * cosphi * (en[1] + sinphi * sinphi * (en[2]
+			+ sinphi * sinphi * (en[3] + sinphi * sinphi * en[4])));
+		x = proj->k0 * al * (MB_PROJ_FC1 +
+			MB_PROJ_FC3 * als * (1.0 - t + n +
+			MB_PROJ_FC5 * als * (5.0 + t * (t - 18.0) + n * (14.0 - 58.0 * t)
+			+ MB_PROJ_FC7 * als * (61.0 + t * (t * (179.0 - t) - 479.0))
+			)));
+		y = proj->k0 * (ml - proj->ml0 +
+			sinphi * al * lam * MB_PROJ_FC2 * (1.0 +
+			MB_PROJ_FC4 * als * (5.0 - t + n * (9.0 + 4.0 * n) +
+			MB_PROJ_FC6 * als * (61.0 + t * (t - 58.0) + n * (270.0 - 330 * t)
+			+ MB_PROJ_FC8 * als * (1385.0 + t * (t * (543.0 - t) - 3111.0))
+			))));
+		easting[i] = proj->fr_meter * (proj->a * x + proj->x0);
+		northing[i] = proj->fr_meter * (proj->a * y + proj->y0);
+		}
+}
+/*--------------------------------------------------------------------*/
+/*
+ * Inverse ellipsoidal transverse Mercator projection of an array of
+ * points, following pj_inv() and the tmerc projection of libproj with
+ * all constants taken from the projection structure. The output arrays
+ * may be the same as the input arrays.
+ */
+static void mb_proj_tm_inverse(struct mb_proj_struct *proj, int npoint,
+		double *easting, double *northing, double *lon, double *lat)
+{
+	double	x, y, lam, phi, arg, s, c, dt;
+	double	n, con, cosphi, d, ds, sinphi, t;
+	double	k = 1.0 / (1.0 - proj->es);
+	double	*en = proj->en;
+	int	i, iter;
+
+	for (i=0;i<npoint;i++)
+		{
+		if (easting[i] == HUGE_VAL || northing[i] == HUGE_VAL)
+			{
+			lon[i] = HUGE_VAL;
+			lat[i] = HUGE_VAL;
+			continue;
+			}
+		x = (easting[i] * proj->to_meter - proj->x0) * proj->ra;
+		y = (northing[i] * proj->to_meter - proj->y0) * proj->ra;
+
+		/* invert the meridional distance as in pj_inv_mlfn() */
+		arg = proj->ml0 + y / proj->k0;
+		phi = arg;
+		for (iter=MB_PROJ_MLFN_ITER;iter;iter--)
+			{
+			s = sin(phi);
+			c = cos(phi);
+			t = 1.0 - proj->es * s * s;
+			dt = (en[0] * phi - s * c * (en[1] + s * s * (en[2]
+				+ s * s * (en[3] + s * s * en[4]))) - arg) * (t * sqrt(t)) * k;
+			phi -= dt;
+			if (fabs(dt) < MB_PROJ_MLFN_EPS)
+				break;
+			}
+		if (iter == 0)
+			{
+			lon[i] = HUGE_VAL;
+			lat[i] = HUGE_VAL;
+			continue;
+			}
+
+		if (fabs(phi) >= M_PI_2)
+			{
+			phi = (y < 0.0 ? -M_PI_2 : M_PI_2);
+			lam = 0.0;
+			}
+		else
+			{
+			sinphi = sin(phi);
+			cosphi = cos(phi);
+			t = (fabs(cosphi) > 1e-10 ? sinphi / cosphi : 0.0);
+			n = proj->esp * cosphi * cosphi;
+			d = x * sqrt(con = 1.0 - proj->es * sinphi * sinphi) / proj->k0;
+			con *= t;
+			t *= t;
+			ds = d * d;
+			phi -= (con * ds / (1.0 - proj->es)) * MB_PROJ_FC2 * (1.0 -
+				ds * MB_PROJ_FC4 * (5.0 + t * (3.0 - 9.0 * n) + n * (1.0 - 4 * n) -
+				ds * MB_PROJ_FC6 * (61.0 + t * (90.0 - 252.0 * n +
+					45.0 * t) + 46.0 * n
+				- ds * MB_PROJ_FC8 * (1385.0 + t * (3633.0 + t * (4095.0 + 1574.0 * t)))
+				)));
+			lam = d * (MB_PROJ_FC1 -
+				ds * MB_PROJ_FC3 * (1.0 + 2.0 * t + n -
+				ds * MB_PROJ_FC5 * (5.0 + t * (28.0 + 24.0 * t + 8.0 * n) + 6.0 * n
+				- ds * MB_PROJ_FC7 * (61.0 + t * (662.0 + t * (1320.0 + 720.0 * t)))
+				))) / cosphi;
+			}
+		lam += proj->lam0;
+		if (fabs(lam) > MB_PROJ_SPI)
+			{
+			lam += M_PI;
+			lam -= 2.0 * M_PI * floor(lam / (2.0 * M_PI));
+			lam -= M_PI;
+			}
+		lon[i] = RTD * lam;
+		lat[i] = RTD * phi;
+		}
+}
+/*--------------------------------------------------------------------*/
@@ -0,0 +1,249 @@
+/*--------------------------------------------------------------------
+ *    The MB-system:	mb_proj_check.c	10/19/2026
+ *    $Id$
+ *
+ *    Copyright (c) 2009-2015 by
+ *    David W. Caress (caress@mbari.org)
+ *      Monterey Bay Aquarium Research Institute
+ *      Moss Landing, CA 95039
+ *    and Dale N. Chayes (dale@ldeo.columbia.edu)
+ *      Lamont-Doherty Earth Observatory
+ *      Palisades, NY 10964
+ *
+ *    See README file for copying and redistribution conditions.
+ *--------------------------------------------------------------------*/
+/*
+ * MB_proj_check checks the built in transverse Mercator kernel of
+ * mb_proj.c against libproj:
+ *   - A set of UTM and transverse Mercator projections must use the
+ *     kernel, and a set of other projections (including a transverse
+ *     Mercator in US survey feet) must fall back to libproj.
+ *   - For each projection, points across the zone are projected with
+ *     mb_proj_forward_array(), mb_proj_forward() and pj_fwd(), and the
+ *     eastings and northings must agree to within a millimeter.
+ *   - The projected points are inverted with mb_proj_inverse_array(),
+ *     mb_proj_inverse() and pj_inv(), and the longitudes and latitudes
+ *     must agree to within about a millimeter on the ground.
+ *   - Points too far from the central meridian must come back as
+ *     HUGE_VAL just as from libproj.
+ * The forward projection of a large array is also timed with the
+ * kernel and with pj_fwd().
+ *
+ * This program is not built or installed with MB-System. It includes
+ * mb_proj.c directly so that the projection structure can be examined,
+ * and can be built in the mbio build directory (where projections.h is
+ * made) with something like:
+ *      cc -I../proj -o mb_proj_check mb_proj_check.c \
+ *              ../proj/.libs/libmbproj.a -lm
+ * and run as:
+ *      mb_proj_check
+ * The exit status is zero if all of the checks pass.
+ */
+
+#include <time.h>
+
+/* the mb_proj functions under test */
+#include "mb_proj.c"
+
+/* tolerances in meters and in degrees */
+#define CHECK_TOLERANCE_XY	0.001
+#define CHECK_TOLERANCE_LL	0.00000001
+#define CHECK_NLON		41
+#define CHECK_NLAT		81
+#define CHECK_NPOINT		(CHECK_NLON * CHECK_NLAT)
+#define CHECK_NTIME		2000000
+
+struct check_projection
+	{
+	char	*name;
+	int	tm;
+	};
+
+static struct check_projection check_projections[] =
+	{
+	{ "UTM10N", MB_YES },		/* UTM north */
+	{ "UTM33S", MB_YES },		/* UTM south */
+	{ "UTM60S", MB_YES },		/* UTM south next to the dateline */
+	{ "epsg32760", MB_YES },	/* UTM south without ellipsoid name */
+	{ "epsg2039", MB_YES },		/* tmerc with lat_0, k, offsets */
+	{ "epsg2193", MB_YES },		/* tmerc New Zealand */
+	{ "epsg27700", MB_YES },	/* tmerc Airy ellipsoid, negative y_0 */
+	{ "epsg31467", MB_YES },	/* tmerc Bessel ellipsoid */
+	{ "epsg2136", MB_YES },		/* tmerc with to_meter */
+	{ "epsg2235", MB_NO },		/* tmerc in US survey feet */
+	{ "epsg3395", MB_NO },		/* Mercator */
+	{ "epsg3031", MB_NO },		/* polar stereographic */
+	{ NULL, MB_NO }
+	};
+
+/*--------------------------------------------------------------------*/
+/* difference of two values allowing for HUGE_VAL in both */
+static double check_diff(double a, double b)
+{
+	if (a == HUGE_VAL && b == HUGE_VAL)
+		return(0.0);
+	else if (a == HUGE_VAL || b == HUGE_VAL)
+		return(HUGE_VAL);
+	else
+		return(fabs(a - b));
+}
+/*--------------------------------------------------------------------*/
+/* longitude difference in degrees allowing for wrap around */
+static double check_diff_lon(double a, double b)
+{
+	double	d;
+
+	d = check_diff(a, b);
+	if (d != HUGE_VAL && d > 180.0)
+		d = fabs(d - 360.0);
+	return(d);
+}
+/*--------------------------------------------------------------------*/
+static int check_projection(struct check_projection *check, int *nfail)
+{
+	char	*function_name = "check_projection";
+	int	status = MB_SUCCESS;
+	int	error = MB_ERROR_NO_ERROR;
+	struct mb_proj_struct *proj;
+	void	*pjptr;
+	double	*lon, *lat, *x, *y, *ilon, *ilat;
+	double	lon0, lat0, xs, ys, lons, lats;
+	double	dxy, dxymax = 0.0, dll, dllmax = 0.0;
+	projUV	pjxy, pjll;
+	int	i, j, k;
+
+	/* initialize the projection */
+	status = mb_proj_init(0, check->name, &pjptr, &error);
+	if (status != MB_SUCCESS)
+		{
+		fprintf(stderr, "%-10s  FAIL  unable to initialize projection\n", check->name);
+		(*nfail)++;
+		return(status);
+		}
+	proj = (struct mb_proj_struct *) pjptr;
+
+	/* points across the zone and beyond, the central meridian
+		for the fallback projections is taken as zero */
+	lon = (double *) malloc(6 * CHECK_NPOINT * sizeof(double));
+	lat = &lon[CHECK_NPOINT];
+	x = &lon[2 * CHECK_NPOINT];
+	y = &lon[3 * CHECK_NPOINT];
+	ilon = &lon[4 * CHECK_NPOINT];
+	ilat = &lon[5 * CHECK_NPOINT];
+	lon0 = (proj->tm == MB_YES ? RTD * proj->lam0 : 0.0);
+	for (i=0;i<CHECK_NLON;i++)
+		for (j=0;j<CHECK_NLAT;j++)
+			{
+			k = i * CHECK_NLAT + j;
+			lon[k] = lon0 - 5.0 + 10.0 * i / (CHECK_NLON - 1);
+			if (i == 0)
+				lon[k] = lon0 - 120.0;
+			lat[k] = -80.0 + 160.0 * j / (CHECK_NLAT - 1);
+			}
+
+	/* forward and inverse projections of the whole array */
+	mb_proj_forward_array(0, pjptr, CHECK_NPOINT, lon, lat, x, y, &error);
+	mb_proj_inverse_array(0, pjptr, CHECK_NPOINT, x, y, ilon, ilat, &error);
+
+	/* compare with libproj and with the single point functions */
+	for (k=0;k<CHECK_NPOINT;k++)
+		{
+		pjll.u = DTR * lon[k];
+		pjll.v = DTR * lat[k];
+		pjxy = pj_fwd(pjll, proj->pj);
+		mb_proj_forward(0, pjptr, lon[k], lat[k], &xs, &ys, &error);
+		dxy = MAX(check_diff(x[k], pjxy.u), check_diff(y[k], pjxy.v));
+		dxy = MAX(dxy, MAX(check_diff(xs, pjxy.u), check_diff(ys, pjxy.v)));
+		dxymax = MAX(dxymax, dxy);
+		if (pjxy.u == HUGE_VAL)
+			continue;
+
+		pjll = pj_inv(pjxy, proj->pj);
+		if (pjll.u != HUGE_VAL)
+			{
+			pjll.u *= RTD;
+			pjll.v *= RTD;
+			}
+		mb_proj_inverse(0, pjptr, pjxy.u, pjxy.v, &lons, &lats, &error);
+		dll = MAX(check_diff_lon(ilon[k], pjll.u), check_diff(ilat[k], pjll.v));
+		dll = MAX(dll, MAX(check_diff_lon(lons, pjll.u), check_diff(lats, pjll.v)));
+		dllmax = MAX(dllmax, dll);
+		}
+
+	/* report */
+	if (proj->tm != check->tm
+		|| dxymax > CHECK_TOLERANCE_XY
+		|| dllmax > CHECK_TOLERANCE_LL)
+		{
+		fprintf(stderr, "%-10s  FAIL", check->name);
+		(*nfail)++;
+		}
+	else
+		fprintf(stderr, "%-10s  ok  ", check->name);
+	fprintf(stderr, "  %-7s  max difference %g m  %g deg\n",
+		(proj->tm == MB_YES ? "kernel" : "libproj"), dxymax, dllmax);
+
+	free(lon);
+	mb_proj_free(0, &pjptr, &error);
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+static void check_timing(char *name)
+{
+	int	error = MB_ERROR_NO_ERROR;
+	struct mb_proj_struct *proj;
+	void	*pjptr;
+	double	*lon, *lat;
+	projUV	pjxy, pjll;
+	clock_t	start;
+	double	tkernel, tproj;
+	int	k;
+
+	if (mb_proj_init(0, name, &pjptr, &error) != MB_SUCCESS)
+		return;
+	proj = (struct mb_proj_struct *) pjptr;
+	lon = (double *) malloc(2 * CHECK_NTIME * sizeof(double));
+	lat = &lon[CHECK_NTIME];
+
+	for (k=0;k<CHECK_NTIME;k++)
+		{
+		lon[k] = RTD * proj->lam0 - 3.0 + 6.0 * (k % 1000) / 1000.0;
+		lat[k] = 30.0 + 10.0 * (k / 1000) / (CHECK_NTIME / 1000);
+		}
+	start = clock();
+	for (k=0;k<CHECK_NTIME;k++)
+		{
+		pjll.u = DTR * lon[k];
+		pjll.v = DTR * lat[k];
+		pjxy = pj_fwd(pjll, proj->pj);
+		}
+	tproj = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	mb_proj_forward_array(0, pjptr, CHECK_NTIME, lon, lat, lon, lat, &error);
+	tkernel = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	fprintf(stderr, "\n%d forward projections with %s:\n", CHECK_NTIME, name);
+	fprintf(stderr, "    pj_fwd():                  %.3f s\n", tproj);
+	fprintf(stderr, "    mb_proj_forward_array():   %.3f s\n", tkernel);
+
+	free(lon);
+	mb_proj_free(0, &pjptr, &error);
+}
+/*--------------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+	int	nfail = 0;
+	int	i;
+
+	for (i=0;check_projections[i].name != NULL;i++)
+		check_projection(&check_projections[i], &nfail);
+	check_timing("UTM10N");
+
+	if (nfail > 0)
+		fprintf(stderr, "\n%d projections FAILED\n", nfail);
+	else
+		fprintf(stderr, "\nAll projections passed\n");
+	return(nfail > 0 ? 1 : 0);
+}
+/*--------------------------------------------------------------------*/
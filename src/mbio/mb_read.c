@@ -246,8 +246,10 @@ int mb_read(int verbose, void *mbio_ptr,
 		/* get next ping */
 		if (mb_io_ptr->need_new_ping)
 			{
+			mb_io_ptr->skip_out_bounds = MB_YES;
 			status = mb_read_ping(verbose,mbio_ptr,store_ptr,
 						&mb_io_ptr->new_kind,error);
+			mb_io_ptr->skip_out_bounds = MB_NO;
 
 			/* log errors */
 			if (*error < MB_ERROR_NO_ERROR)
@@ -180,6 +180,8 @@ int mb_read_init(int verbose, char *file,
 		}
 	mb_io_ptr->speedmin = speedmin;
 	mb_io_ptr->timegap = timegap;
+	mb_io_ptr->skip_out_bounds = MB_NO;
+	mb_io_ptr->scan_ancillary = MB_NO;
 
 	/* get mbio internal time */
 	status = mb_get_time(verbose,mb_io_ptr->btime_i,btime_d);
@@ -510,26 +510,21 @@ int mb_segy_close(int verbose,void **mbsegyio_ptr, int *error)
 }
 
 /*--------------------------------------------------------------------*/
-/* 	function mb_segy_read_trace reads a trace header and the trace
-	data from an open segy file. The trace data array is passed
-	in as a handle along with the allocated memory so that
-	additional memory can be allocated if necessary */
-int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
+/* 	function mb_segy_read_traceheader reads only the next trace header
+	from an open segy file. The trace data may then be read with
+	mb_segy_read_trace, or skipped by reading the next trace header,
+	so that traces outside a window of interest are never read */
+int mb_segy_read_traceheader(int verbose, void *mbsegyio_ptr,
 		struct mb_segytraceheader_struct *traceheaderptr,
-		float **traceptr,
 		int *error)
 {
-  	char	*function_name = "mb_segy_read_trace";
+  	char	*function_name = "mb_segy_read_traceheader";
 	int	status = MB_SUCCESS;
 	struct mb_segyio_struct *mb_segyio_ptr;
 	struct mb_segyfileheader_struct *fileheader;
 	struct mb_segytraceheader_struct *traceheader;
-	float	*trace;
 	char	*buffer;
 	int	index;
-	int	bytes_per_sample;
-	int	intval;
-	short	shortval;
 	int	i;
 
 	/* print input debug statements */
@@ -541,8 +536,6 @@ int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
 		fprintf(stderr,"dbg2       verbose:          %d\n",verbose);
 		fprintf(stderr,"dbg2       mbsegyio_ptr:     %p\n",(void *)mbsegyio_ptr);
 		fprintf(stderr,"dbg2       traceheaderptr:   %p\n",(void *)traceheaderptr);
-		fprintf(stderr,"dbg2       traceptr:         %p\n",(void *)traceptr);
-		fprintf(stderr,"dbg2       *traceptr:        %p\n",(void *)*traceptr);
 		}
 
 	/* get segyio pointer */
@@ -550,6 +543,18 @@ int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
 	fileheader = (struct mb_segyfileheader_struct *) &(mb_segyio_ptr->fileheader);
 	traceheader = (struct mb_segytraceheader_struct *) &(mb_segyio_ptr->traceheader);
 
+	/* skip the trace data of the previous trace if it was not read */
+	if (mb_segyio_ptr->traceheader_read == MB_YES)
+		{
+		mb_segyio_ptr->traceheader_read = MB_NO;
+		if (fseek(mb_segyio_ptr->fp,
+			(long) mb_segyio_ptr->bytes_per_sample * traceheader->nsamps, SEEK_CUR) != 0)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_EOF;
+			}
+		}
+
 	/* make sure there is adequate memory in the buffer */
 	if (mb_segyio_ptr->bufferalloc < MB_SEGY_TRACEHEADER_LENGTH)
 		{
@@ -649,31 +654,158 @@ int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
         	mb_get_binary_float(MB_NO, (void *) &(buffer[index]), &(traceheader->heading)); index += 4;
 		}
 
-	/* make sure there is adequate memory */
+	/* get bytes per sample */
 	if (status == MB_SUCCESS)
 		{
-		/* get bytes per sample */
- 		if (fileheader->format == 5 || fileheader->format == 6 || fileheader->format == 11 || fileheader->format == 2)
-       			{
-			bytes_per_sample = 4;
-			}
- 		else if (fileheader->format == 1)
-       			{
-			bytes_per_sample = 4;
-			}
- 		else if (fileheader->format == 3)
-       			{
-			bytes_per_sample = 2;
-			}
- 		else if (fileheader->format == 8)
-       			{
-			bytes_per_sample = 1;
-			}
+		if (fileheader->format == 3)
+			mb_segyio_ptr->bytes_per_sample = 2;
+		else if (fileheader->format == 8)
+			mb_segyio_ptr->bytes_per_sample = 1;
 		else
-       			{
-			bytes_per_sample = 4;
+			mb_segyio_ptr->bytes_per_sample = 4;
+		}
+
+	/* the trace data are now next in the file */
+	if (status == MB_SUCCESS)
+		{
+		mb_segyio_ptr->traceheader_read = MB_YES;
+		*traceheaderptr = *traceheader;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return value:\n");
+		fprintf(stderr,"dbg2       seq_num:       %d\n",traceheader->seq_num);
+		fprintf(stderr,"dbg2       seq_reel:      %d\n",traceheader->seq_reel);
+		fprintf(stderr,"dbg2       shot_num:      %d\n",traceheader->shot_num);
+		fprintf(stderr,"dbg2       shot_tr:       %d\n",traceheader->shot_tr);
+		fprintf(stderr,"dbg2       espn:          %d\n",traceheader->espn);
+		fprintf(stderr,"dbg2       rp_num:        %d\n",traceheader->rp_num);
+		fprintf(stderr,"dbg2       rp_tr:         %d\n",traceheader->rp_tr);
+		fprintf(stderr,"dbg2       trc_id:        %d\n",traceheader->trc_id);
+		fprintf(stderr,"dbg2       num_vstk:      %d\n",traceheader->num_vstk);
+		fprintf(stderr,"dbg2       cdp_fold:      %d\n",traceheader->cdp_fold);
+		fprintf(stderr,"dbg2       use:           %d\n",traceheader->use);
+		fprintf(stderr,"dbg2       range:         %d\n",traceheader->range);
+		fprintf(stderr,"dbg2       grp_elev:      %d\n",traceheader->grp_elev);
+		fprintf(stderr,"dbg2       src_elev:      %d\n",traceheader->src_elev);
+		fprintf(stderr,"dbg2       src_depth:     %d\n",traceheader->src_depth);
+		fprintf(stderr,"dbg2       grp_datum:     %d\n",traceheader->grp_datum);
+		fprintf(stderr,"dbg2       src_datum:     %d\n",traceheader->src_datum);
+		fprintf(stderr,"dbg2       src_wbd:       %d\n",traceheader->src_wbd);
+		fprintf(stderr,"dbg2       grp_wbd:       %d\n",traceheader->grp_wbd);
+		fprintf(stderr,"dbg2       elev_scalar:   %d\n",traceheader->elev_scalar);
+		fprintf(stderr,"dbg2       coord_scalar:  %d\n",traceheader->coord_scalar);
+		fprintf(stderr,"dbg2       src_long:      %d\n",traceheader->src_long);
+		fprintf(stderr,"dbg2       src_lat:       %d\n",traceheader->src_lat);
+		fprintf(stderr,"dbg2       grp_long:      %d\n",traceheader->grp_long);
+		fprintf(stderr,"dbg2       grp_lat:       %d\n",traceheader->grp_lat);
+		fprintf(stderr,"dbg2       coord_units:   %d\n",traceheader->coord_units);
+		fprintf(stderr,"dbg2       wvel:          %d\n",traceheader->wvel);
+		fprintf(stderr,"dbg2       sbvel:         %d\n",traceheader->sbvel);
+		fprintf(stderr,"dbg2       src_up_vel:    %d\n",traceheader->src_up_vel);
+		fprintf(stderr,"dbg2       grp_up_vel:    %d\n",traceheader->grp_up_vel);
+		fprintf(stderr,"dbg2       src_static:    %d\n",traceheader->src_static);
+		fprintf(stderr,"dbg2       grp_static:    %d\n",traceheader->grp_static);
+		fprintf(stderr,"dbg2       tot_static:    %d\n",traceheader->tot_static);
+		fprintf(stderr,"dbg2       laga:          %d\n",traceheader->laga);
+		fprintf(stderr,"dbg2       delay_mils:    %d\n",traceheader->delay_mils);
+		fprintf(stderr,"dbg2       smute_mils:    %d\n",traceheader->smute_mils);
+		fprintf(stderr,"dbg2       emute_mils:    %d\n",traceheader->emute_mils);
+		fprintf(stderr,"dbg2       nsamps:        %d\n",traceheader->nsamps);
+		fprintf(stderr,"dbg2       si_micros:     %d\n",traceheader->si_micros);
+		for (i=0;i<19;i++)
+			{
+			fprintf(stderr,"dbg2       other_1[%d]:   %d\n",i,traceheader->other_1[i]);
+			}
+		fprintf(stderr,"dbg2       year:          %d\n",traceheader->year);
+		fprintf(stderr,"dbg2       day_of_yr:     %d\n",traceheader->day_of_yr);
+		fprintf(stderr,"dbg2       hour:          %d\n",traceheader->hour);
+		fprintf(stderr,"dbg2       min:           %d\n",traceheader->min);
+		fprintf(stderr,"dbg2       sec:           %d\n",traceheader->sec);
+		fprintf(stderr,"dbg2       mils:          %d\n",traceheader->mils);
+		fprintf(stderr,"dbg2       tr_weight:     %d\n",traceheader->tr_weight);
+		for (i=0;i<5;i++)
+			{
+			fprintf(stderr,"dbg2       other_2[%d]:    %d\n",i,traceheader->other_2[i]);
 			}
+		fprintf(stderr,"dbg2       delay:         %f\n",traceheader->delay);
+		fprintf(stderr,"dbg2       smute_sec:     %f\n",traceheader->smute_sec);
+		fprintf(stderr,"dbg2       emute_sec:     %f\n",traceheader->emute_sec);
+		fprintf(stderr,"dbg2       si_secs:       %f\n",traceheader->si_secs);
+		fprintf(stderr,"dbg2       wbt_secs:      %f\n",traceheader->wbt_secs);
+		fprintf(stderr,"dbg2       end_of_rp:     %d\n",traceheader->end_of_rp);
+		fprintf(stderr,"dbg2       dummy1:        %f\n",traceheader->dummy1);
+		fprintf(stderr,"dbg2       dummy2:        %f\n",traceheader->dummy2);
+		fprintf(stderr,"dbg2       dummy3:        %f\n",traceheader->dummy3);
+		fprintf(stderr,"dbg2       dummy4:        %f\n",traceheader->dummy4);
+		fprintf(stderr,"dbg2       soundspeed:    %f\n",traceheader->soundspeed);
+		fprintf(stderr,"dbg2       distance:      %f\n",traceheader->distance);
+		fprintf(stderr,"dbg2       roll:          %f\n",traceheader->roll);
+		fprintf(stderr,"dbg2       pitch:         %f\n",traceheader->pitch);
+		fprintf(stderr,"dbg2       heading:       %f\n",traceheader->heading);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:       %d\n",status);
+		}
 
+	/* return success */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+/* 	function mb_segy_read_trace reads a trace header and the trace
+	data from an open segy file. If the trace header has already been
+	read with mb_segy_read_traceheader only the trace data are read.
+	The trace data array is passed in as a handle along with the
+	allocated memory so that additional memory can be allocated if
+	necessary */
+int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
+		struct mb_segytraceheader_struct *traceheaderptr,
+		float **traceptr,
+		int *error)
+{
+  	char	*function_name = "mb_segy_read_trace";
+	int	status = MB_SUCCESS;
+	struct mb_segyio_struct *mb_segyio_ptr;
+	struct mb_segyfileheader_struct *fileheader;
+	struct mb_segytraceheader_struct *traceheader;
+	float	*trace;
+	char	*buffer;
+	int	index;
+	int	bytes_per_sample;
+	int	intval;
+	short	shortval;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:          %d\n",verbose);
+		fprintf(stderr,"dbg2       mbsegyio_ptr:     %p\n",(void *)mbsegyio_ptr);
+		fprintf(stderr,"dbg2       traceheaderptr:   %p\n",(void *)traceheaderptr);
+		fprintf(stderr,"dbg2       traceptr:         %p\n",(void *)traceptr);
+		fprintf(stderr,"dbg2       *traceptr:        %p\n",(void *)*traceptr);
+		}
+
+	/* get segyio pointer */
+	mb_segyio_ptr = (struct mb_segyio_struct *) mbsegyio_ptr;
+	fileheader = (struct mb_segyfileheader_struct *) &(mb_segyio_ptr->fileheader);
+	traceheader = (struct mb_segytraceheader_struct *) &(mb_segyio_ptr->traceheader);
+
+	/* read the trace header unless that has already been done */
+	if (mb_segyio_ptr->traceheader_read == MB_NO)
+		status = mb_segy_read_traceheader(verbose, mbsegyio_ptr, traceheaderptr, error);
+	bytes_per_sample = mb_segyio_ptr->bytes_per_sample;
+
+	/* make sure there is adequate memory */
+	if (status == MB_SUCCESS)
+		{
 		/* check buffer memory */
 		if (mb_segyio_ptr->bufferalloc < bytes_per_sample * traceheader->nsamps)
 			{
@@ -710,41 +842,51 @@ int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
 			*error = MB_ERROR_EOF;
 			}
 		}
+	mb_segyio_ptr->traceheader_read = MB_NO;
 
 	/* extract trace data */
 	if (status == MB_SUCCESS)
 		{
 		trace = (float *) mb_segyio_ptr->trace;
 		index = 0;
-		for (i=0;i<traceheader->nsamps;i++)
-			{
- 			if (fileheader->format == 5 || fileheader->format == 6 || fileheader->format == 1)
-       				{
+ 		if (fileheader->format == 5 || fileheader->format == 6 || fileheader->format == 1)
+       			{
+			for (i=0;i<traceheader->nsamps;i++)
+				{
 				mb_get_binary_float(MB_NO, (void *) &(buffer[index]), &(trace[i]));
 				index += bytes_per_sample;
 				}
- 			else if (fileheader->format == 11)
-       				{
+			}
+ 		else if (fileheader->format == 11)
+       			{
+			for (i=0;i<traceheader->nsamps;i++)
+				{
 				mb_get_binary_float(MB_YES, (void *) &(buffer[index]), &(trace[i]));
 				index += bytes_per_sample;
 				}
- 			else if (fileheader->format == 2)
-       				{
+			}
+ 		else if (fileheader->format == 2)
+       			{
+			for (i=0;i<traceheader->nsamps;i++)
+				{
 				mb_get_binary_int(MB_NO, (void *) &(buffer[index]), &(intval));
 				trace[i] = (float) intval;
 				index += bytes_per_sample;
 				}
- 			else if (fileheader->format == 3)
-       				{
+			}
+ 		else if (fileheader->format == 3)
+       			{
+			for (i=0;i<traceheader->nsamps;i++)
+				{
 				mb_get_binary_short(MB_NO, (void *) &(buffer[index]), &(shortval));
 				trace[i] = (float) shortval;
 				index += bytes_per_sample;
 				}
- 			else if (fileheader->format == 8)
-       				{
+			}
+ 		else if (fileheader->format == 8)
+       			{
+			for (i=0;i<traceheader->nsamps;i++)
 				trace[i] = (float) buffer[i];
-				index++;
-				}
 			}
 		}
 
@@ -207,6 +207,8 @@ struct mb_segyio_struct
 	struct mb_segytraceheader_struct traceheader;
 	int	tracealloc;
 	float	*trace;
+	int	traceheader_read;
+	int	bytes_per_sample;
 	};
 
 /* function prototypes */
@@ -221,6 +223,9 @@ int mb_segy_write_init(int verbose, char *segyfile,
 		void **mbsegyio_ptr,
 		int *error);
 int mb_segy_close(int verbose,void **mbsegyio_ptr, int *error);
+int mb_segy_read_traceheader(int verbose, void *mbsegyio_ptr,
+		struct mb_segytraceheader_struct *traceheaderptr,
+		int *error);
 int mb_segy_read_trace(int verbose, void *mbsegyio_ptr,
 		struct mb_segytraceheader_struct *traceheaderptr,
 		float **traceptr,
@@ -147,6 +147,8 @@ int mb_write_init(int verbose,
 		}
 	mb_io_ptr->speedmin = 0.0;
 	mb_io_ptr->timegap = 0.0;
+	mb_io_ptr->skip_out_bounds = MB_NO;
+	mb_io_ptr->scan_ancillary = MB_NO;
 	mb_io_ptr->btime_d = 0.0;
 	mb_io_ptr->etime_d = 0.0;
 
@@ -1596,7 +1596,8 @@ Have a nice day...\n");
 		/* allocate secondary data structure for
 			water column data if needed */
 		if (status == MB_SUCCESS &&
-			(type == EM3_WATERCOLUMN))
+			(type == EM3_WATERCOLUMN)
+			&& mb_io_ptr->scan_ancillary == MB_NO)
 			{
 			if (store->wc == NULL)
 			    status = mbsys_simrad3_wc_alloc(
@@ -1658,6 +1659,31 @@ Have a nice day...\n");
 #endif
 			done = MB_NO;
 			}
+		else if (mb_io_ptr->scan_ancillary == MB_YES
+			&& (type == EM3_RAWBEAM4
+				|| type == EM3_QUALITY
+				|| type == EM3_SS2
+				|| type == EM3_WATERCOLUMN))
+			{
+#ifdef MBR_EM710RAW_DEBUG
+	fprintf(stderr,"scan mode, seek over %d bytes of datagram type %x\n",
+			*record_size_save, type);
+#endif
+			/* in scan mode seek over the per-ping beam, sidescan
+				and water column datagrams without decoding them */
+			if (fseek(mbfp, (long)(*record_size_save - 4), SEEK_CUR) == 0)
+				{
+				done = MB_NO;
+				good_end_bytes = MB_YES;
+				}
+			else
+				{
+				status = MB_FAILURE;
+				*error = MB_ERROR_EOF;
+				done = MB_YES;
+				good_end_bytes = MB_NO;
+				}
+			}
 		else if (type == EM3_PU_STATUS)
 			{
 #ifdef MBR_EM710RAW_DEBUG
@@ -1898,7 +1924,14 @@ Have a nice day...\n");
 				store->pings[store->ping_index].png_bath_read = MB_YES;
 				done = MB_NO;
 				}
-			if (status == MB_SUCCESS && sonar == MBSYS_SIMRAD3_M3)
+			if (status == MB_SUCCESS && mb_io_ptr->scan_ancillary == MB_YES)
+				{
+				/* in scan mode the raw beam, quality and sidescan
+					datagrams are skipped, so the ping is complete */
+				store->pings[store->ping_index].read_status = MBSYS_SIMRAD3_PING_COMPLETE;
+				done = MB_YES;
+				}
+			else if (status == MB_SUCCESS && sonar == MBSYS_SIMRAD3_M3)
 				{
 				if (store->pings[store->ping_index].png_bath_read == MB_YES
 					&& store->pings[store->ping_index].png_raw_read == MB_YES
@@ -439,6 +439,8 @@ int mbr_rt_mbldeoih(int verbose, void *mbio_ptr, void *store_ptr, int *error)
 	double	depthmax;
 	int	time_i[7], time_j[6];
 	int	version;
+	int	skip;
+	long	skip_size;
 	int	i;
 
 	/* print input debug statements */
@@ -780,6 +782,13 @@ int mbr_rt_mbldeoih(int verbose, void *mbio_ptr, void *store_ptr, int *error)
 		fprintf(stderr,"dbg5       error:            %d\n",*error);
 		}
 
+	/* the header holds the time and navigation, so the beam data can
+		be skipped if the ping lies outside the location or time bounds */
+	skip = MB_NO;
+	if (status == MB_SUCCESS && store->kind == MB_DATA_DATA)
+		status = mb_skip_ping(verbose, mbio_ptr, store->time_d,
+				store->longitude, store->latitude, &skip, error);
+
 	/* read next chunk of the data */
 	if (status == MB_SUCCESS
 		&& store->kind == MB_DATA_COMMENT)
@@ -806,6 +815,43 @@ int mbr_rt_mbldeoih(int verbose, void *mbio_ptr, void *store_ptr, int *error)
 			fprintf(stderr,"dbg5       comment: %s\n",store->comment);
 			}
 		}
+	else if (status == MB_SUCCESS
+		&& store->kind == MB_DATA_DATA
+		&& skip == MB_YES)
+		{
+		/* seek past the beam arrays */
+		skip_size = (sizeof(char) + 3 * sizeof(short int)) * store->beams_bath
+				+ sizeof(short int) * store->beams_amp
+				+ 3 * sizeof(short int) * store->pixels_ss;
+		if (fseek(mb_io_ptr->mbfp, skip_size, SEEK_CUR) == 0)
+			{
+			mb_io_ptr->file_bytes += skip_size;
+			status = MB_SUCCESS;
+			*error = MB_ERROR_NO_ERROR;
+			}
+		else
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_EOF;
+			}
+
+		/* update maximum numbers of beams and pixels */
+		mb_io_ptr->beams_bath_max = MAX(mb_io_ptr->beams_bath_max, store->beams_bath);
+		mb_io_ptr->beams_amp_max = MAX(mb_io_ptr->beams_amp_max, store->beams_amp);
+		mb_io_ptr->pixels_ss_max = MAX(mb_io_ptr->pixels_ss_max, store->pixels_ss);
+
+		/* no beam data are held for the skipped ping */
+		store->beams_bath = 0;
+		store->beams_amp = 0;
+		store->pixels_ss = 0;
+
+		/* print debug messages */
+		if (verbose >= 5 && status == MB_SUCCESS)
+			{
+			fprintf(stderr,"\ndbg5  Data skipped in function <%s>\n",function_name);
+			fprintf(stderr,"dbg5       skip_size:  %ld\n",skip_size);
+			}
+		}
 	else if (status == MB_SUCCESS
 		&& store->kind == MB_DATA_DATA)
 		{
@@ -9276,19 +9276,19 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	struct mb_io_struct *mb_io_ptr;
 	struct mbsys_reson7k_struct *store;
 	struct mbsys_reson7k_struct *copy;
-	s7kr_attitude *attitude;
-	s7kr_motion *motion;
-	s7kr_svp *svp;
-	s7kr_ctd *ctd;
-	s7kr_fsdwss *fsdwsslo;
-	s7kr_fsdwss *fsdwsshi;
-	s7kr_fsdwsb *fsdwsb;
-	s7kr_configuration *configuration;
-	s7kr_backscatter *backscatter;
-	s7kr_beam		*beam;
-	s7kr_tvg		*tvg;
-	s7kr_image		*image;
-	s7kr_systemeventmessage *systemeventmessage;
+	s7kr_attitude attitude;
+	s7kr_motion motion;
+	s7kr_svp svp;
+	s7kr_ctd ctd;
+	s7kr_fsdwss fsdwsslo;
+	s7kr_fsdwss fsdwsshi;
+	s7kr_fsdwsb fsdwsb;
+	s7kr_configuration configuration;
+	s7kr_backscatter backscatter;
+	s7kr_snippet	snippet;
+	s7kr_tvg	tvg;
+	s7kr_image	image;
+	s7kr_systemeventmessage systemeventmessage;
 	int	nalloc;
 	char	*charptr, *copycharptr;
 	int	i, j;
@@ -9312,7 +9312,9 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	store = (struct mbsys_reson7k_struct *) store_ptr;
 	copy = (struct mbsys_reson7k_struct *) copy_ptr;
 
-	/* copy over structures, allocating memory where necessary */
+	/* copy over structures, allocating memory where necessary - the
+		arrays already allocated in copy are kept and reused, so the
+		copy's sub-structures are saved before being overwritten */
 
 	/* Type of data record */
 	copy->kind = store->kind;			/* MB-System record ID */
@@ -9337,13 +9339,13 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->position = store->position;
 
 	/* Attitude (record 1004) */
-	attitude = &copy->attitude;
+	attitude = copy->attitude;
 	copy->attitude = store->attitude;
-	copy->attitude.nalloc = attitude->nalloc;
-	copy->attitude.pitch = attitude->pitch;
-	copy->attitude.roll = attitude->roll;
-	copy->attitude.heading = attitude->heading;
-	copy->attitude.heave = attitude->heave;
+	copy->attitude.nalloc = attitude.nalloc;
+	copy->attitude.pitch = attitude.pitch;
+	copy->attitude.roll = attitude.roll;
+	copy->attitude.heading = attitude.heading;
+	copy->attitude.heave = attitude.heave;
 	if (status == MB_SUCCESS
 		&& copy->attitude.nalloc < copy->attitude.n * sizeof(float))
 		{
@@ -9384,15 +9386,15 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->altitude = store->altitude;
 
 	/* Motion over ground (record 1007) */
-	motion = &copy->motion;
+	motion = copy->motion;
 	copy->motion = store->motion;
-	copy->motion.nalloc = motion->nalloc;
-	copy->motion.x = motion->x;
-	copy->motion.y = motion->y;
-	copy->motion.z = motion->z;
-	copy->motion.xa = motion->xa;
-	copy->motion.ya = motion->ya;
-	copy->motion.za = motion->za;
+	copy->motion.nalloc = motion.nalloc;
+	copy->motion.x = motion.x;
+	copy->motion.y = motion.y;
+	copy->motion.z = motion.z;
+	copy->motion.xa = motion.xa;
+	copy->motion.ya = motion.ya;
+	copy->motion.za = motion.za;
 	if (status == MB_SUCCESS
 		&& copy->motion.nalloc < copy->motion.n * sizeof(float))
 		{
@@ -9438,11 +9440,11 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->depth = store->depth;
 
 	/* Sound velocity profile (record 1009) */
-	svp = &copy->svp;
+	svp = copy->svp;
 	copy->svp = store->svp;
-	copy->svp.nalloc = svp->nalloc;
-	copy->svp.depth = svp->depth;
-	copy->svp.sound_velocity = svp->sound_velocity;
+	copy->svp.nalloc = svp.nalloc;
+	copy->svp.depth = svp.depth;
+	copy->svp.sound_velocity = svp.sound_velocity;
 	if (status == MB_SUCCESS
 		&& copy->svp.nalloc < copy->svp.n * sizeof(float))
 		{
@@ -9469,14 +9471,14 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* CTD (record 1010) */
-	ctd = &copy->ctd;
+	ctd = copy->ctd;
 	copy->ctd = store->ctd;
-	copy->ctd.nalloc = ctd->nalloc;
-	copy->ctd.conductivity_salinity = ctd->conductivity_salinity;
-	copy->ctd.temperature = ctd->temperature;
-	copy->ctd.pressure_depth = ctd->pressure_depth;
-	copy->ctd.sound_velocity = ctd->sound_velocity;
-	copy->ctd.absorption = ctd->absorption;
+	copy->ctd.nalloc = ctd.nalloc;
+	copy->ctd.conductivity_salinity = ctd.conductivity_salinity;
+	copy->ctd.temperature = ctd.temperature;
+	copy->ctd.pressure_depth = ctd.pressure_depth;
+	copy->ctd.sound_velocity = ctd.sound_velocity;
+	copy->ctd.absorption = ctd.absorption;
 	if (status == MB_SUCCESS
 		&& copy->ctd.nalloc < copy->ctd.n * sizeof(float))
 		{
@@ -9518,12 +9520,12 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->geodesy = store->geodesy;
 
 	/* Edgetech FS-DW low frequency sidescan (record 3000) */
-	fsdwsslo = &copy->fsdwsslo;
+	fsdwsslo = copy->fsdwsslo;
 	copy->fsdwsslo = store->fsdwsslo;
 	for (j=0;j<2;j++)
 		{
-		copy->fsdwsslo.channel[j].data_alloc = fsdwsslo->channel[j].data_alloc;
-		copy->fsdwsslo.channel[j].data = fsdwsslo->channel[j].data;
+		copy->fsdwsslo.channel[j].data_alloc = fsdwsslo.channel[j].data_alloc;
+		copy->fsdwsslo.channel[j].data = fsdwsslo.channel[j].data;
 		if (status == MB_SUCCESS
 			&& copy->fsdwsslo.channel[j].data_alloc
 				< copy->fsdwsslo.channel[j].number_samples
@@ -9543,7 +9545,8 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 			}
 		if (status == MB_SUCCESS)
 			{
-			for (i=0;i<copy->fsdwsslo.channel[j].data_alloc;i++)
+			for (i=0;i<copy->fsdwsslo.channel[j].number_samples
+					* copy->fsdwsslo.channel[j].bytespersample;i++)
 				{
 				copy->fsdwsslo.channel[j].data[i]
 					= store->fsdwsslo.channel[j].data[i];
@@ -9552,12 +9555,12 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* Edgetech FS-DW high frequency sidescan (record 3000) */
-	fsdwsshi = &copy->fsdwsshi;
+	fsdwsshi = copy->fsdwsshi;
 	copy->fsdwsshi = store->fsdwsshi;
 	for (j=0;j<2;j++)
 		{
-		copy->fsdwsshi.channel[j].data_alloc = fsdwsshi->channel[j].data_alloc;
-		copy->fsdwsshi.channel[j].data = fsdwsshi->channel[j].data;
+		copy->fsdwsshi.channel[j].data_alloc = fsdwsshi.channel[j].data_alloc;
+		copy->fsdwsshi.channel[j].data = fsdwsshi.channel[j].data;
 		if (status == MB_SUCCESS
 			&& copy->fsdwsshi.channel[j].data_alloc
 				< copy->fsdwsshi.channel[j].number_samples
@@ -9577,7 +9580,8 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 			}
 		if (status == MB_SUCCESS)
 			{
-			for (i=0;i<copy->fsdwsshi.channel[j].data_alloc;i++)
+			for (i=0;i<copy->fsdwsshi.channel[j].number_samples
+					* copy->fsdwsshi.channel[j].bytespersample;i++)
 				{
 				copy->fsdwsshi.channel[j].data[i]
 					= store->fsdwsshi.channel[j].data[i];
@@ -9586,10 +9590,10 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* Edgetech FS-DW subbottom (record 3001) */
-	fsdwsb = &copy->fsdwsb;
+	fsdwsb = copy->fsdwsb;
 	copy->fsdwsb = store->fsdwsb;
-	copy->fsdwsb.channel.data_alloc = fsdwsb->channel.data_alloc;
-	copy->fsdwsb.channel.data = fsdwsb->channel.data;
+	copy->fsdwsb.channel.data_alloc = fsdwsb.channel.data_alloc;
+	copy->fsdwsb.channel.data = fsdwsb.channel.data;
 	if (status == MB_SUCCESS
 		&& copy->fsdwsb.channel.data_alloc
 			< copy->fsdwsb.channel.number_samples
@@ -9609,7 +9613,8 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 	if (status == MB_SUCCESS)
 		{
-		for (i=0;i<copy->fsdwsb.channel.data_alloc;i++)
+		for (i=0;i<copy->fsdwsb.channel.number_samples
+				* copy->fsdwsb.channel.bytespersample;i++)
 			{
 			copy->fsdwsb.channel.data[i]
 				= store->fsdwsb.channel.data[i];
@@ -9623,12 +9628,12 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->volatilesettings = store->volatilesettings;
 
 	/* Reson 7k configuration (record 7001) */
-	configuration = &copy->configuration;
+	configuration = copy->configuration;
 	copy->configuration = store->configuration;
 	for (j=0;j<MBSYS_RESON7K_MAX_DEVICE;j++)
 		{
-		copy->configuration.device[j].info_alloc = configuration->device[j].info_alloc;
-		copy->configuration.device[j].info = configuration->device[j].info;
+		copy->configuration.device[j].info_alloc = configuration.device[j].info_alloc;
+		copy->configuration.device[j].info = configuration.device[j].info;
 		if (status == MB_SUCCESS
 			&& copy->configuration.device[j].info_alloc
 				< copy->configuration.device[j].info_length)
@@ -9663,11 +9668,11 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->bathymetry = store->bathymetry;
 
 	/* Reson 7k backscatter imagery data (record 7007) */
-	backscatter = &copy->backscatter;
+	backscatter = copy->backscatter;
 	copy->backscatter = store->backscatter;
-	copy->backscatter.nalloc = backscatter->nalloc;
-	copy->backscatter.port_data = backscatter->port_data;
-	copy->backscatter.stbd_data = backscatter->stbd_data;
+	copy->backscatter.nalloc = backscatter.nalloc;
+	copy->backscatter.port_data = backscatter.port_data;
+	copy->backscatter.stbd_data = backscatter.stbd_data;
 	if (status == MB_SUCCESS
 		&& copy->backscatter.nalloc
 			< copy->backscatter.number_samples
@@ -9688,7 +9693,8 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 	if (status == MB_SUCCESS)
 		{
-		for (i=0;i<copy->backscatter.number_samples;i++)
+		for (i=0;i<copy->backscatter.number_samples
+				* copy->backscatter.sample_size;i++)
 			{
 			copy->backscatter.port_data[i] = store->backscatter.port_data[i];
 			copy->backscatter.stbd_data[i] = store->backscatter.stbd_data[i];
@@ -9696,14 +9702,25 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* Reson 7k beam data (record 7008) */
-	beam = &copy->beam;
-	copy->beam = store->beam;
+	copy->beam.header = store->beam.header;
+	copy->beam.serial_number = store->beam.serial_number;
+	copy->beam.ping_number = store->beam.ping_number;
+	copy->beam.multi_ping = store->beam.multi_ping;
+	copy->beam.number_beams = store->beam.number_beams;
+	copy->beam.reserved = store->beam.reserved;
+	copy->beam.number_samples = store->beam.number_samples;
+	copy->beam.record_subset_flag = store->beam.record_subset_flag;
+	copy->beam.row_column_flag = store->beam.row_column_flag;
+	copy->beam.sample_header_id = store->beam.sample_header_id;
+	copy->beam.sample_type = store->beam.sample_type;
 	for (i=0;i<MBSYS_RESON7K_MAX_RECEIVERS;i++)
 		{
-		copy->beam.snippets[i].nalloc_amp = beam->snippets[i].nalloc_amp;
-		copy->beam.snippets[i].nalloc_phase = beam->snippets[i].nalloc_phase;
-		copy->beam.snippets[i].amplitude = beam->snippets[i].amplitude;
-		copy->beam.snippets[i].phase = beam->snippets[i].phase;
+		snippet = copy->beam.snippets[i];
+		copy->beam.snippets[i] = store->beam.snippets[i];
+		copy->beam.snippets[i].nalloc_amp = snippet.nalloc_amp;
+		copy->beam.snippets[i].nalloc_phase = snippet.nalloc_phase;
+		copy->beam.snippets[i].amplitude = snippet.amplitude;
+		copy->beam.snippets[i].phase = snippet.phase;
 		if (status == MB_SUCCESS
 			&& (copy->beam.snippets[i].nalloc_amp < store->beam.snippets[i].nalloc_amp
 				|| copy->beam.snippets[i].nalloc_phase < store->beam.snippets[i].nalloc_phase))
@@ -9728,11 +9745,11 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 			{
 			copycharptr = (char *)(copy->beam.snippets[i].amplitude);
 			charptr = (char *)(store->beam.snippets[i].amplitude);
-			for (j=0;j<copy->beam.snippets[i].nalloc_amp;j++)
+			for (j=0;j<store->beam.snippets[i].nalloc_amp;j++)
 				copycharptr[j] = charptr[j];
 			copycharptr = (char *)(copy->beam.snippets[i].phase);
 			charptr = (char *)(store->beam.snippets[i].phase);
-			for (j=0;j<copy->beam.snippets[i].nalloc_phase;j++)
+			for (j=0;j<store->beam.snippets[i].nalloc_phase;j++)
 				copycharptr[j] = charptr[j];
 			}
 
@@ -9742,11 +9759,11 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 	copy->verticaldepth = store->verticaldepth;
 
 	/* Reson 7k tvg data (record 7010) */
-	tvg = &copy->tvg;
+	tvg = copy->tvg;
 	copy->tvg = store->tvg;
-	copy->tvg.nalloc = tvg->nalloc;
-	copy->tvg.tvg = tvg->tvg;
-	nalloc = tvg->n * sizeof(float);
+	copy->tvg.nalloc = tvg.nalloc;
+	copy->tvg.tvg = tvg.tvg;
+	nalloc = copy->tvg.n * sizeof(float);
 	if (status == MB_SUCCESS
 		&& copy->tvg.nalloc < nalloc)
 		{
@@ -9769,11 +9786,11 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* Reson 7k image data (record 7011) */
-	image = &copy->image;
+	image = copy->image;
 	copy->image = store->image;
-	copy->image.nalloc = image->nalloc;
-	copy->image.image = image->image;
-	nalloc = image->width * image->height * image->color_depth;
+	copy->image.nalloc = image.nalloc;
+	copy->image.image = image.image;
+	nalloc = copy->image.width * copy->image.height * copy->image.color_depth;
 	if (status == MB_SUCCESS
 		&& copy->image.nalloc < nalloc)
 		{
@@ -9798,10 +9815,10 @@ int mbsys_reson7k_copy(int verbose, void *mbio_ptr,
 		}
 
 	/* Reson 7k system event (record 7051) */
-	systemeventmessage = &copy->systemeventmessage;
+	systemeventmessage = copy->systemeventmessage;
 	copy->systemeventmessage = store->systemeventmessage;
-	copy->systemeventmessage.message_alloc = systemeventmessage->message_alloc;
-	copy->systemeventmessage.message = systemeventmessage->message;
+	copy->systemeventmessage.message_alloc = systemeventmessage.message_alloc;
+	copy->systemeventmessage.message = systemeventmessage.message;
 	if (status == MB_SUCCESS
 		&& copy->systemeventmessage.message_alloc
 			< copy->systemeventmessage.message_length)
@@ -454,6 +454,10 @@ int	mbnavadjust_file_open(char *projectname);
 int	mbnavadjust_close_project(void);
 int	mbnavadjust_write_project(void);
 int	mbnavadjust_read_project(void);
+int	mbnavadjust_write_snapshot(void);
+int	mbnavadjust_read_snapshot(void);
+int	mbnavadjust_snapshot_mark(void);
+int	mbnavadjust_snapshot_checksum(char *path, unsigned int *checksum);
 int	mbnavadjust_import_data(char *path, int format);
 int	mbnavadjust_import_file(char *path, int format, int firstfile);
 int 	mbnavadjust_bin_bathymetry(double altitude, int beams_bath, char *beamflag, double *bath,
@@ -490,6 +494,10 @@ int	mbnavadjust_crossing_load(void);
 int	mbnavadjust_crossing_unload(void);
 int	mbnavadjust_crossing_replot(void);
 int	mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, void **swath_ptr, int num_pings);
+int	mbnavadjust_section_cache_get(int file_id, int section_id, void **swathraw_ptr);
+int	mbnavadjust_section_cache_put(int file_id, int section_id, void *swathraw_ptr);
+int	mbnavadjust_section_cache_clear(void);
+int	mbnavadjust_section_cache_free(void *swathraw_ptr);
 int	mbnavadjust_section_translate(int file_id, void *swathraw_ptr, void *swath_ptr, double zoffset);
 int	mbnavadjust_section_contour(int fileid, int sectionid,
 				struct swath *swath,
@@ -4927,6 +4927,9 @@ do_quit( Widget w, XtPointer client_data, XtPointer call_data)
     XmAnyCallbackStruct *acs;
     acs = (XmAnyCallbackStruct*)call_data;
 
+    /* keep a snapshot of the open project for the next open */
+    mbnavadjust_write_snapshot();
+
     /* unload loaded crossing */
     if (mbna_naverr_load == MB_YES)
 	    {
@@ -30,6 +30,7 @@
 /* standard include files */
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <unistd.h>
 #include <math.h>
 #include <string.h>
@@ -76,6 +77,24 @@ struct swathraw
 	struct pingraw *pingraws;
 	};
 
+/* raw section data are kept after a crossing is unloaded so that
+	sections shared by successive crossings are read only once */
+#define	MBNA_SECTION_CACHE_MAX	12
+struct mbna_section_cache
+	{
+	int	file_id;
+	int	section_id;
+	int	last_use;
+	struct swathraw *swathraw;
+	};
+
+/* binary snapshot of the parsed project kept in the project directory
+	so that a project can be reopened without parsing the home file */
+#define	MBNA_SNAPSHOT_FILE	"project.nvb"
+#define	MBNA_SNAPSHOT_VERSION	2
+#define	MBNA_SNAPSHOT_NHEADER	12
+#define	MBNA_SNAPSHOT_NSOURCE	3
+
 /* id variables */
 static char rcs_id[] = "$Id$";
 static char program_name[] = "mbnavadjust";
@@ -148,6 +167,17 @@ struct swath *swath1 = NULL;
 struct swath *swath2 = NULL;
 struct ping *ping = NULL;
 
+/* raw section cache */
+static struct mbna_section_cache section_cache[MBNA_SECTION_CACHE_MAX];
+static int	section_cache_num = 0;
+static int	section_cache_use = 0;
+
+/* state of the home file when it was last written or parsed - a
+	snapshot is only written on close if the home file is unchanged */
+static int	snapshot_due = MB_NO;
+static long	snapshot_home_size = 0;
+static long	snapshot_home_mtime = 0;
+
 /* misfit grid parameters */
 int	grid_nx = 0;
 int	grid_ny = 0;
@@ -921,7 +951,11 @@ int mbnavadjust_close_project()
 	    do_info_add(message, MB_YES);
 	    }
 
+	/* keep a snapshot of the project for the next open */
+	mbnavadjust_write_snapshot();
+
 	/* deallocate memory and reset values */
+	mbnavadjust_section_cache_clear();
 	for (i=0;i<project.num_files;i++)
 		{
 		file = &project.files[i];
@@ -948,6 +982,7 @@ int mbnavadjust_close_project()
 
 	/* reset values */
 	project.open = MB_NO;
+	snapshot_due = MB_NO;
 	memset(project.name,0,STRING_MAX);
 	strcpy(project.name,"None");
  	memset(project.path,0,STRING_MAX);
@@ -993,6 +1028,7 @@ int mbnavadjust_write_project()
 	char	routename[STRING_MAX];
 	char	xoffsetfile[STRING_MAX];
 	char	yoffsetfile[STRING_MAX];
+	char	coverage_row[MBNA_MASK_DIM+2];
 	double	navlon1, navlon2, navlat1, navlat2;
 	int	nroute;
 	int	snav_1, snav_2;
@@ -1096,9 +1132,11 @@ fprintf(stderr,"Writing project %s\n", project.name);
 				    {
 				    for (l=0;l<MBNA_MASK_DIM;l++)
 					{
-					fprintf(hfp, "%1d", section->coverage[l+k*MBNA_MASK_DIM]);
+					coverage_row[l] = '0' + section->coverage[l+k*MBNA_MASK_DIM];
 					}
-				    fprintf(hfp, "\n");
+				    coverage_row[MBNA_MASK_DIM] = '\n';
+				    coverage_row[MBNA_MASK_DIM+1] = '\0';
+				    fputs(coverage_row, hfp);
 				    }
 				for (k=0;k<section->num_snav;k++)
 				    {
@@ -1179,6 +1217,9 @@ fprintf(stderr,"Writing project %s\n", project.name);
 		/* close home file */
 		fclose(hfp);
 		status = MB_SUCCESS;
+
+		/* note the home file state for the snapshot written on close */
+		mbnavadjust_snapshot_mark();
 		}
 
 	/* else set error */
@@ -2041,9 +2082,14 @@ int mbnavadjust_read_project()
 	sprintf(command,"cp %s %s.save", project.home, project.home);
 	shellstatus = system(command);
 
-	/* open and read home file */
+	/* load the binary snapshot written with the last save if the home
+		file has not changed since, otherwise open and read home file */
 	status = MB_SUCCESS;
-	if ((hfp = fopen(project.home,"r")) != NULL)
+	if (mbnavadjust_read_snapshot() == MB_SUCCESS)
+		{
+		project.open = MB_YES;
+		}
+	else if ((hfp = fopen(project.home,"r")) != NULL)
 		{
 		/* check for proper header */
 		if ((result = fgets(buffer,BUFFER_MAX,hfp)) != buffer
@@ -2382,7 +2428,8 @@ fprintf(stderr, "read failed on section: %s\n", buffer);
 					    result = fgets(buffer,BUFFER_MAX,hfp);
 					for (l=0;l<MBNA_MASK_DIM;l++)
 						{
-						sscanf(&buffer[l], "%1d", &section->coverage[l+k*MBNA_MASK_DIM]);
+						if (buffer[l] >= '0' && buffer[l] <= '9')
+							section->coverage[l+k*MBNA_MASK_DIM] = buffer[l] - '0';
 						}
 					}
 if (status == MB_FAILURE){fprintf(stderr,"Die at line:%d file:%s\n",__LINE__,__FILE__);exit(0);}
@@ -2884,7 +2931,12 @@ fprintf(stderr,"Reset tie snav_2 on read:%d\n",tie->snav_2);
 
 		/* set project status flag */
 		if (status == MB_SUCCESS)
+			{
 			project.open = MB_YES;
+
+			/* note the home file state for the snapshot written on close */
+			mbnavadjust_snapshot_mark();
+			}
 		else
 			{
 			for (i=0;i<project.num_files;i++)
@@ -2915,7 +2967,16 @@ fprintf(stderr,"Reset tie snav_2 on read:%d\n",tie->snav_2);
 			project.num_truecrossings_analyzed = 0;
 			project.num_ties = 0;
  			}
+		}
+
+	/* else set error */
+	else
+		{
+		status = MB_FAILURE;
+		}
 
+	if (status == MB_SUCCESS)
+		{
 		/* recalculate crossing overlap values if not already set */
 		if (project.open == MB_YES)
 			{
@@ -2971,10 +3032,496 @@ fprintf(stderr,"Reset tie snav_2 on read:%d\n",tie->snav_2);
 			mbnavadjust_interpolatesolution();
 		}
 
-	/* else set error */
+	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:       %d\n",error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_snapshot_mark()
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_snapshot_mark";
+	int	status = MB_SUCCESS;
+	struct stat file_status;
+
+	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		}
+
+	/* the in-memory project now matches the home file, so note the
+		state of the home file for the snapshot written on close -
+		only a stat is done here so that saves do not pay for the
+		snapshot */
+	if (stat(project.home,&file_status) == 0)
+		{
+		snapshot_due = MB_YES;
+		snapshot_home_size = (long) file_status.st_size;
+		snapshot_home_mtime = (long) file_status.st_mtime;
+		}
 	else
 		{
+		snapshot_due = MB_NO;
+		status = MB_FAILURE;
+		}
+
+	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       snapshot_due: %d\n",snapshot_due);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_snapshot_checksum(char *path, unsigned int *checksum)
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_snapshot_checksum";
+	int	status = MB_SUCCESS;
+	FILE	*cfp;
+	unsigned char buffer[BUFFER_MAX];
+	size_t	nread;
+	size_t	i;
+
+	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       path:        %s\n",path);
+		}
+
+	/* 32 bit FNV-1a hash of the file contents */
+	*checksum = 2166136261U;
+	if ((cfp = fopen(path,"rb")) != NULL)
+		{
+		while ((nread = fread(buffer, 1, BUFFER_MAX, cfp)) > 0)
+			for (i=0;i<nread;i++)
+				*checksum = (*checksum ^ buffer[i]) * 16777619U;
+		if (ferror(cfp))
+			status = MB_FAILURE;
+		fclose(cfp);
+		}
+	else
 		status = MB_FAILURE;
+
+	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       checksum:    %u\n",*checksum);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_write_snapshot()
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_write_snapshot";
+	int	status = MB_SUCCESS;
+	FILE	*sfp;
+	struct mbna_file *file;
+	struct mbna_crossing *crossing;
+	char	snapshotfile[STRING_MAX];
+	char	tmpfile[STRING_MAX];
+	int	header[MBNA_SNAPSHOT_NHEADER];
+	long	source[MBNA_SNAPSHOT_NSOURCE];
+	unsigned int checksum;
+	double	values[6];
+	struct stat file_status;
+	int	i;
+
+	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		}
+
+	/* the snapshot is written when the project is closed, and only
+		if the home file is still as it was when it was last written
+		or parsed, so that the in-memory project matches it - the
+		snapshot is tagged with the size, modification time, and a
+		checksum of the contents of the home file - values are kept
+		at full precision, while the home file rounds them to its
+		text formats, so a project reopened from the snapshot may
+		differ from one parsed from the home file in the last printed
+		digit - it is written to a temporary file and renamed so that
+		a partial snapshot is never read */
+	if (project.open != MB_YES || snapshot_due != MB_YES)
+		return(MB_SUCCESS);
+	snapshot_due = MB_NO;
+	sprintf(snapshotfile,"%s/%s",project.datadir,MBNA_SNAPSHOT_FILE);
+	sprintf(tmpfile,"%s.%d",snapshotfile,getpid());
+	if (stat(project.home,&file_status) == 0
+		&& (long) file_status.st_size == snapshot_home_size
+		&& (long) file_status.st_mtime == snapshot_home_mtime
+		&& mbnavadjust_snapshot_checksum(project.home, &checksum) == MB_SUCCESS
+		&& (sfp = fopen(tmpfile,"wb")) != NULL)
+		{
+		strncpy((char *)&header[0],"MBNS",4);
+		header[1] = MBNA_SNAPSHOT_VERSION;
+		header[2] = sizeof(struct mbna_file);
+		header[3] = sizeof(struct mbna_section);
+		header[4] = offsetof(struct mbna_crossing, ties);
+		header[5] = sizeof(struct mbna_tie);
+		header[6] = project.num_files;
+		header[7] = project.num_blocks;
+		header[8] = project.num_crossings;
+		header[9] = project.section_soundings;
+		header[10] = project.decimation;
+		header[11] = project.inversion;
+		source[0] = (long) file_status.st_size;
+		source[1] = (long) file_status.st_mtime;
+		source[2] = (long) checksum;
+		values[0] = project.section_length;
+		values[1] = project.cont_int;
+		values[2] = project.col_int;
+		values[3] = project.tick_int;
+		values[4] = project.smoothing;
+		values[5] = project.zoffsetwidth;
+		if (fwrite(header, sizeof(int), MBNA_SNAPSHOT_NHEADER, sfp) != MBNA_SNAPSHOT_NHEADER
+			|| fwrite(source, sizeof(long), MBNA_SNAPSHOT_NSOURCE, sfp) != MBNA_SNAPSHOT_NSOURCE
+			|| fwrite(values, sizeof(double), 6, sfp) != 6)
+			status = MB_FAILURE;
+
+		/* files are followed by their sections, and crossings are
+			written without their unused tie slots */
+		for (i=0;i<project.num_files && status == MB_SUCCESS;i++)
+			{
+			file = &project.files[i];
+			if (fwrite(file, sizeof(struct mbna_file), 1, sfp) != 1
+				|| (file->num_sections > 0
+				    && fwrite(file->sections, sizeof(struct mbna_section),
+						file->num_sections, sfp) != file->num_sections))
+				status = MB_FAILURE;
+			}
+		for (i=0;i<project.num_crossings && status == MB_SUCCESS;i++)
+			{
+			crossing = &project.crossings[i];
+			if (fwrite(crossing, offsetof(struct mbna_crossing, ties), 1, sfp) != 1
+				|| (crossing->num_ties > 0
+				    && fwrite(crossing->ties, sizeof(struct mbna_tie),
+						crossing->num_ties, sfp) != crossing->num_ties))
+				status = MB_FAILURE;
+			}
+		if (fclose(sfp) != 0)
+			status = MB_FAILURE;
+		if (status == MB_SUCCESS && rename(tmpfile, snapshotfile) != 0)
+			status = MB_FAILURE;
+		if (status == MB_FAILURE)
+			remove(tmpfile);
+		}
+	else
+		{
+		status = MB_FAILURE;
+		}
+
+	/* a stale snapshot must not outlive a failed write */
+	if (status == MB_FAILURE)
+		remove(snapshotfile);
+
+	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:       %d\n",error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_read_snapshot()
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_read_snapshot";
+	int	status = MB_SUCCESS;
+	FILE	*sfp;
+	struct mbna_file *file;
+	struct mbna_section *section, *section1, *section2;
+	struct mbna_crossing *crossing;
+	struct mbna_tie *tie;
+	char	snapshotfile[STRING_MAX];
+	int	header[MBNA_SNAPSHOT_NHEADER];
+	long	source[MBNA_SNAPSHOT_NSOURCE];
+	unsigned int checksum;
+	double	values[6];
+	double	mtodeglon, mtodeglat;
+	struct stat file_status;
+	int	i, j, k;
+
+	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		}
+
+	/* use the snapshot only if the home file has not been changed
+		since the snapshot was written - the home file remains the
+		project of record and is parsed whenever it has been edited,
+		merged, or copied from elsewhere - the size and modification
+		time are checked first, and the contents checksum catches an
+		edit within the same second that keeps the same size */
+	sprintf(snapshotfile,"%s/%s",project.datadir,MBNA_SNAPSHOT_FILE);
+	if (stat(project.home,&file_status) != 0
+		|| (sfp = fopen(snapshotfile,"rb")) == NULL)
+		{
+		status = MB_FAILURE;
+		}
+	else
+		{
+		if (fread(header, sizeof(int), MBNA_SNAPSHOT_NHEADER, sfp) != MBNA_SNAPSHOT_NHEADER
+			|| fread(source, sizeof(long), MBNA_SNAPSHOT_NSOURCE, sfp) != MBNA_SNAPSHOT_NSOURCE
+			|| fread(values, sizeof(double), 6, sfp) != 6
+			|| strncmp((char *)&header[0],"MBNS",4) != 0
+			|| header[1] != MBNA_SNAPSHOT_VERSION
+			|| header[2] != sizeof(struct mbna_file)
+			|| header[3] != sizeof(struct mbna_section)
+			|| header[4] != offsetof(struct mbna_crossing, ties)
+			|| header[5] != sizeof(struct mbna_tie)
+			|| header[6] < 0
+			|| header[8] < 0
+			|| source[0] != (long) file_status.st_size
+			|| source[1] != (long) file_status.st_mtime
+			|| mbnavadjust_snapshot_checksum(project.home, &checksum) != MB_SUCCESS
+			|| source[2] != (long) checksum)
+			status = MB_FAILURE;
+
+		/* allocate the files and crossings arrays */
+		if (status == MB_SUCCESS)
+			{
+			project.num_files = header[6];
+			project.num_blocks = header[7];
+			project.num_crossings = header[8];
+			project.section_soundings = header[9];
+			project.decimation = header[10];
+			project.inversion = header[11];
+			project.section_length = values[0];
+			project.cont_int = values[1];
+			project.col_int = values[2];
+			project.tick_int = values[3];
+			project.smoothing = values[4];
+			project.zoffsetwidth = values[5];
+			project.precision = SIGMA_MINIMUM;
+			project.num_files_alloc = 0;
+			project.num_crossings_alloc = 0;
+			project.files = NULL;
+			project.crossings = NULL;
+			if (project.num_files > 0)
+				{
+				if ((project.files = (struct mbna_file *)
+					calloc(project.num_files, sizeof(struct mbna_file))) != NULL)
+					project.num_files_alloc = project.num_files;
+				else
+					status = MB_FAILURE;
+				}
+			if (status == MB_SUCCESS && project.num_crossings > 0)
+				{
+				if ((project.crossings = (struct mbna_crossing *)
+					calloc(project.num_crossings, sizeof(struct mbna_crossing))) != NULL)
+					project.num_crossings_alloc = project.num_crossings;
+				else
+					status = MB_FAILURE;
+				}
+			}
+
+		/* read files and sections, resetting the values that are not
+			kept in the home file just as a parse of it would */
+		project.num_snavs = 0;
+		project.num_pings = 0;
+		project.num_beams = 0;
+		for (i=0;i<project.num_files && status == MB_SUCCESS;i++)
+			{
+			file = &project.files[i];
+			if (fread(file, sizeof(struct mbna_file), 1, sfp) != 1
+				|| file->num_sections < 0)
+				{
+				file->num_sections = 0;
+				status = MB_FAILURE;
+				}
+			file->sections = NULL;
+			file->num_sections_alloc = 0;
+			if (status == MB_SUCCESS && file->num_sections > 0)
+				{
+				if ((file->sections = (struct mbna_section *)
+					malloc(sizeof(struct mbna_section) * file->num_sections)) != NULL)
+					file->num_sections_alloc = file->num_sections;
+				if (file->sections == NULL
+					|| fread(file->sections, sizeof(struct mbna_section),
+						file->num_sections, sfp) != file->num_sections)
+					status = MB_FAILURE;
+				}
+			if (status == MB_SUCCESS)
+				{
+				if (file->file[0] == '/')
+				    strcpy(file->path, file->file);
+				else
+				    {
+				    strcpy(file->path, project.path);
+				    strcat(file->path, file->file);
+				    }
+				file->show_in_modelplot = MB_NO;
+				file->num_snavs = 0;
+				file->num_pings = 0;
+				file->num_beams = 0;
+				}
+			for (j=0;j<file->num_sections && status == MB_SUCCESS;j++)
+				{
+				section = &file->sections[j];
+				for (k=0;k<MBNA_SNAV_NUM;k++)
+					{
+					section->snav_num_ties[k] = 0;
+					section->snav_invert_id[k] = 0;
+					section->snav_invert_constraint[k] = 0;
+					section->snav_lon_offset_int[k] = 0.0;
+					section->snav_lat_offset_int[k] = 0.0;
+					section->snav_z_offset_int[k] = 0.0;
+					}
+				section->show_in_modelplot = MB_NO;
+				section->modelplot_start_count = 0;
+				mb_coor_scale(mbna_verbose,0.5 * (section->latmin + section->latmax),
+						&mtodeglon,&mtodeglat);
+				section->global_tie_offset_x_m = section->global_tie_offset_x / mtodeglon;
+				section->global_tie_offset_y_m = section->global_tie_offset_y / mtodeglat;
+				section->global_start_ping = project.num_pings;
+				section->global_start_snav = project.num_snavs - section->continuity;
+				file->num_snavs += section->num_pings;
+				file->num_pings += section->num_pings;
+				file->num_beams += section->num_beams;
+				project.num_snavs += (section->num_snav - section->continuity);
+				project.num_pings += section->num_pings;
+				project.num_beams += section->num_beams;
+				}
+			}
+
+		/* read crossings and ties */
+ 		project.num_crossings_analyzed = 0;
+		project.num_goodcrossings = 0;
+		project.num_truecrossings = 0;
+		project.num_truecrossings_analyzed = 0;
+ 		project.num_ties = 0;
+		for (i=0;i<project.num_crossings && status == MB_SUCCESS;i++)
+			{
+			crossing = &project.crossings[i];
+			if (fread(crossing, offsetof(struct mbna_crossing, ties), 1, sfp) != 1
+				|| crossing->num_ties < 0 || crossing->num_ties > MBNA_SNAV_NUM
+				|| crossing->file_id_1 < 0 || crossing->file_id_1 >= project.num_files
+				|| crossing->file_id_2 < 0 || crossing->file_id_2 >= project.num_files
+				|| crossing->section_1 < 0
+				|| crossing->section_1 >= project.files[crossing->file_id_1].num_sections
+				|| crossing->section_2 < 0
+				|| crossing->section_2 >= project.files[crossing->file_id_2].num_sections
+				|| (crossing->num_ties > 0
+				    && fread(crossing->ties, sizeof(struct mbna_tie),
+						crossing->num_ties, sfp) != crossing->num_ties))
+				{
+				status = MB_FAILURE;
+				break;
+				}
+			if (crossing->status != MBNA_CROSSING_STATUS_NONE)
+				project.num_crossings_analyzed++;
+			if (crossing->truecrossing == MB_YES)
+				{
+				project.num_truecrossings++;
+				if (crossing->status != MBNA_CROSSING_STATUS_NONE)
+				project.num_truecrossings_analyzed++;
+				}
+			section1 = &(project.files[crossing->file_id_1].sections[crossing->section_1]);
+			section2 = &(project.files[crossing->file_id_2].sections[crossing->section_2]);
+			for (j=0;j<crossing->num_ties;j++)
+				{
+				tie = &crossing->ties[j];
+				if (tie->snav_1 < 0 || tie->snav_1 >= MBNA_SNAV_NUM
+					|| tie->snav_2 < 0 || tie->snav_2 >= MBNA_SNAV_NUM)
+					{
+					status = MB_FAILURE;
+					break;
+					}
+				if (tie->sigmar1 <= 0.0)
+					mbna_minmisfit_sr1 = 1.0;
+				if (tie->sigmar2 <= 0.0)
+					mbna_minmisfit_sr2 = 1.0;
+				if (tie->sigmar3 <= 0.0)
+					mbna_minmisfit_sr3 = 1.0;
+				tie->block_1 = 0;
+				tie->block_2 = 0;
+				tie->isurveyplotindex = 0;
+				project.num_ties++;
+				section1->snav_num_ties[tie->snav_1]++;
+				section2->snav_num_ties[tie->snav_2]++;
+
+				/* calculate offsets in local meters */
+				mbna_lon_min = MIN(section1->lonmin,section2->lonmin);
+				mbna_lon_max = MAX(section1->lonmax,section2->lonmax);
+				mbna_lat_min = MIN(section1->latmin,section2->latmin);
+				mbna_lat_max = MAX(section1->latmax,section2->latmax);
+				mb_coor_scale(mbna_verbose,0.5 * (mbna_lat_min + mbna_lat_max),
+						&mbna_mtodeglon,&mbna_mtodeglat);
+				tie->offset_x_m = tie->offset_x / mbna_mtodeglon;
+				tie->offset_y_m = tie->offset_y / mbna_mtodeglat;
+				tie->inversion_offset_x_m = tie->inversion_offset_x / mbna_mtodeglon;
+				tie->inversion_offset_y_m = tie->inversion_offset_y / mbna_mtodeglat;
+				}
+			}
+		fclose(sfp);
+
+		/* on failure release whatever was read so that the caller
+			can fall back to parsing the home file */
+		if (status == MB_FAILURE)
+			{
+			for (i=0;i<project.num_files_alloc;i++)
+				{
+				file = &project.files[i];
+				if (file->sections != NULL)
+					free(file->sections);
+				}
+			if (project.files != NULL)
+				free(project.files);
+			if (project.crossings != NULL)
+				free(project.crossings);
+			project.files = NULL;
+			project.crossings = NULL;
+			project.num_files = 0;
+			project.num_files_alloc = 0;
+			project.num_crossings = 0;
+			project.num_crossings_alloc = 0;
+			project.num_snavs = 0;
+			project.num_pings = 0;
+			project.num_beams = 0;
+			project.num_ties = 0;
+			project.num_crossings_analyzed = 0;
+			project.num_goodcrossings = 0;
+			project.num_truecrossings = 0;
+			project.num_truecrossings_analyzed = 0;
+			}
 		}
 
 	/* print output debug statements */
@@ -4357,6 +4904,11 @@ int mbnavadjust_findcrossingsfile(int ifile)
 	double	cell2lonmin, cell2lonmax, cell2latmin, cell2latmax;
 	double	dx1, dy1, dx2, dy2;
 	int	ii1, jj1, kk1, ii2, jj2, kk2;
+	int	ii1min, ii1max, jj1min, jj1max;
+	double	*filebounds = NULL;
+	int	*filecrossings = NULL;
+	int	nfilecrossings, nfilecrossings_alloc;
+	int	i;
 
  	/* print input debug statements */
 	if (mbna_verbose >= 2)
@@ -4372,7 +4924,49 @@ int mbnavadjust_findcrossingsfile(int ifile)
 		{
 		file2 = &(project.files[ifile]);
 
+		/* get the bounds of each file to be searched, adjusted for the most
+			recent inversion solution, so that files that cannot contain a
+			crossing are skipped without testing each of their sections */
+		status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, 4 * (ifile + 1) * sizeof(double),
+					(void **)&filebounds, &error);
+		for (jfile=0;status == MB_SUCCESS && jfile<=ifile;jfile++)
+			{
+			file1 = &(project.files[jfile]);
+			for (jsection=0;jsection<file1->num_sections;jsection++)
+				{
+				section1 = &(file1->sections[jsection]);
+				lonoffset1 = section1->snav_lon_offset[section1->num_snav/2];
+				latoffset1 = section1->snav_lat_offset[section1->num_snav/2];
+				if (jsection == 0 || section1->lonmin + lonoffset1 < filebounds[4*jfile])
+					filebounds[4*jfile] = section1->lonmin + lonoffset1;
+				if (jsection == 0 || section1->lonmax + lonoffset1 > filebounds[4*jfile+1])
+					filebounds[4*jfile+1] = section1->lonmax + lonoffset1;
+				if (jsection == 0 || section1->latmin + latoffset1 < filebounds[4*jfile+2])
+					filebounds[4*jfile+2] = section1->latmin + latoffset1;
+				if (jsection == 0 || section1->latmax + latoffset1 > filebounds[4*jfile+3])
+					filebounds[4*jfile+3] = section1->latmax + latoffset1;
+				}
+			}
+
+		/* get list of existing crossings involving this file so that
+			checking for duplicates does not require searching all crossings */
+		nfilecrossings = 0;
+		nfilecrossings_alloc = project.num_crossings + ALLOC_NUM;
+		if (status == MB_SUCCESS)
+			status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, nfilecrossings_alloc * sizeof(int),
+					(void **)&filecrossings, &error);
+		for (icrossing=0;status == MB_SUCCESS && icrossing<project.num_crossings;icrossing++)
+			{
+			crossing = &(project.crossings[icrossing]);
+			if (crossing->file_id_1 == ifile || crossing->file_id_2 == ifile)
+				{
+				filecrossings[nfilecrossings] = icrossing;
+				nfilecrossings++;
+				}
+			}
+
 		/* loop over all sections */
+		if (status == MB_SUCCESS)
 		for (isection=0;isection<file2->num_sections;isection++)
 			{
 			section2 = &(file2->sections[isection]);
@@ -4391,6 +4985,10 @@ int mbnavadjust_findcrossingsfile(int ifile)
 			for (jfile=0;jfile<=ifile;jfile++)
 				{
 				file1 = &(project.files[jfile]);
+				if (file1->num_sections <= 0
+					|| !(lonmin2 < filebounds[4*jfile+1] && lonmax2 > filebounds[4*jfile]
+						&& latmin2 < filebounds[4*jfile+3] && latmax2 > filebounds[4*jfile+2]))
+					continue;
 				if (jfile < ifile)
 					jsectionmax = file1->num_sections;
 				else
@@ -4436,15 +5034,30 @@ int mbnavadjust_findcrossingsfile(int ifile)
 								cell2latmin = latmin2 + jj2 * dy2;
 								cell2latmax = latmin2 + (jj2 + 1) * dy2;
 
-								for (ii1=0;ii1<MBNA_MASK_DIM && overlap == 0;ii1++)
-								for (jj1=0;jj1<MBNA_MASK_DIM && overlap == 0;jj1++)
+								/* only test the cells of the other mask that can overlap this cell */
+								ii1min = 0;
+								ii1max = MBNA_MASK_DIM - 1;
+								jj1min = 0;
+								jj1max = MBNA_MASK_DIM - 1;
+								if (dx1 > 0.0)
+									{
+									ii1min = MAX((int)floor((cell2lonmin - lonmin1) / dx1), 0);
+									ii1max = MIN((int)ceil((cell2lonmax - lonmin1) / dx1), MBNA_MASK_DIM - 1);
+									}
+								if (dy1 > 0.0)
+									{
+									jj1min = MAX((int)floor((cell2latmin - latmin1) / dy1), 0);
+									jj1max = MIN((int)ceil((cell2latmax - latmin1) / dy1), MBNA_MASK_DIM - 1);
+									}
+								for (ii1=ii1min;ii1<=ii1max && overlap == 0;ii1++)
+								for (jj1=jj1min;jj1<=jj1max && overlap == 0;jj1++)
 									{
 									kk1 = ii1 + jj1 * MBNA_MASK_DIM;
 									if (section1->coverage[kk1] == 1)
 										{
 										cell1lonmin = lonmin1 + ii1 * dx1;
 										cell1lonmax = lonmin1 + (ii1 + 1) * dx1;
-										cell1latmin = latmin1 + jj1 * dy2;
+										cell1latmin = latmin1 + jj1 * dy1;
 										cell1latmax = latmin1 + (jj1 + 1) * dy1;
 
 										/* check if these two cells overlap */
@@ -4464,9 +5077,9 @@ int mbnavadjust_findcrossingsfile(int ifile)
 					if (disqualify == MB_NO && overlap > 0)
 						{
 						found = MB_NO;
-						for (icrossing=0;icrossing<project.num_crossings && found == MB_NO;icrossing++)
+						for (i=0;i<nfilecrossings && found == MB_NO;i++)
 							{
-							crossing = &(project.crossings[icrossing]);
+							crossing = &(project.crossings[filecrossings[i]]);
 							if (crossing->file_id_2 == ifile && crossing->file_id_1 == jfile
 								&& crossing->section_2 == isection && crossing->section_1 == jsection)
 								{
@@ -4506,6 +5119,19 @@ int mbnavadjust_findcrossingsfile(int ifile)
 							crossing->num_ties = 0;
 							project.num_crossings++;
 
+							/* add crossing to the list for this file */
+							if (nfilecrossings_alloc <= nfilecrossings)
+								{
+								nfilecrossings_alloc += ALLOC_NUM;
+								status = mb_reallocd(mbna_verbose, __FILE__, __LINE__, nfilecrossings_alloc * sizeof(int),
+										(void **)&filecrossings, &error);
+								}
+							if (status == MB_SUCCESS)
+								{
+								filecrossings[nfilecrossings] = project.num_crossings - 1;
+								nfilecrossings++;
+								}
+
 fprintf(stderr,"added crossing: %d  %4d %4d   %4d %4d\n",
 project.num_crossings-1,
 crossing->file_id_1,crossing->section_1,
@@ -4524,6 +5150,12 @@ file1->id,jsection, disqualify, overlap);*/
 					}
 				}
 			}
+
+		/* deallocate arrays */
+		if (filebounds != NULL)
+			mb_freed(mbna_verbose, __FILE__, __LINE__, (void **)&filebounds, &error);
+		if (filecrossings != NULL)
+			mb_freed(mbna_verbose, __FILE__, __LINE__, (void **)&filecrossings, &error);
 		}
 
  	/* print output debug statements */
@@ -6733,8 +7365,6 @@ int mbnavadjust_crossing_unload()
 	/* local variables */
 	char	*function_name = "mbnavadjust_crossing_unload";
 	int	status = MB_SUCCESS;
-	struct pingraw *pingraw;
-   	int	i;
 
  	/* print input debug statements */
 	if (mbna_verbose >= 2)
@@ -6746,35 +7376,9 @@ int mbnavadjust_crossing_unload()
 	/* unload loaded crossing */
 	if (mbna_naverr_load == MB_YES)
 		{
-		/* free raw swath data */
-		if (swathraw1 != NULL && swathraw1->pingraws != NULL)
-		    {
-		    for (i=0;i<swathraw1->npings_max;i++)
-			{
-			pingraw = &swathraw1->pingraws[i];
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->beamflag, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bath, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathacrosstrack, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathalongtrack, &error);
-			}
-		    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw1->pingraws, &error);
-		    }
-		if (swathraw2 != NULL && swathraw2->pingraws != NULL)
-		    {
-		    for (i=0;i<swathraw2->npings_max;i++)
-			{
-			pingraw = &swathraw2->pingraws[i];
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->beamflag, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bath, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathacrosstrack, &error);
-			status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathalongtrack, &error);
-			}
-		    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw2->pingraws, &error);
-		    }
-		if (swathraw1 != NULL)
-		    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw1, &error);
-		if (swathraw2 != NULL)
-		    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw2, &error);
+		/* the raw swath data stay in the section cache */
+		swathraw1 = NULL;
+		swathraw2 = NULL;
 
 		/* free contours */
 		status = mb_contour_deall(mbna_verbose,swath1,&error);
@@ -6938,8 +7542,9 @@ int mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, v
 	char	path[STRING_MAX];
 	int	iformat;
 	double	tick_len_map, label_hgt_map;
+	int	cached;
 	int	done;
-   	int	i;
+   	int	i, iping;
 
  	/* print input debug statements */
 	if (mbna_verbose >= 2)
@@ -6964,8 +7569,17 @@ int mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, v
 		file = &(project.files[file_id]);
 		section = &(file->sections[section_id]);
 
+		/* use the raw data if the section has been read before */
+		cached = MB_NO;
+		if (mbnavadjust_section_cache_get(file_id, section_id, swathraw_ptr) == MB_SUCCESS)
+			{
+			cached = MB_YES;
+			swathraw = (struct swathraw *) *swathraw_ptr;
+			}
+
 		/* initialize section for reading */
-		if ((status = mb_read_init(
+		if (cached == MB_NO
+			&& (status = mb_read_init(
 			mbna_verbose,path,iformat,pings,lonflip,bounds,
 			btime_i,etime_i,speedmin,timegap,
 			&imbio_ptr,&btime_d,&etime_d,
@@ -6978,7 +7592,7 @@ int mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, v
 			}
 
 		/* allocate memory for data arrays */
-		if (status == MB_SUCCESS)
+		if (status == MB_SUCCESS && cached == MB_NO)
 			{
 			if (error == MB_ERROR_NO_ERROR)
 			    status = mb_register_array(mbna_verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
@@ -7014,70 +7628,34 @@ int mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, v
 				}
 			}
 
-		/* allocate memory for data arrays */
-		if (status == MB_SUCCESS)
-			{
-			/* get mb_io_ptr */
-			imb_io_ptr = (struct mb_io_struct *) imbio_ptr;
-
-			/* initialize data storage */
-			status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, sizeof(struct swathraw),
-						(void **)swathraw_ptr, &error);
-			swathraw = (struct swathraw *) *swathraw_ptr;
-			swathraw->beams_bath = beams_bath;
-			swathraw->npings_max = num_pings;
-			swathraw->npings = 0;
-			status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, num_pings * sizeof(struct pingraw),
-						(void **)&swathraw->pingraws, &error);
-			for (i=0;i<swathraw->npings_max;i++)
-				{
-				pingraw = &swathraw->pingraws[i];
-				pingraw->beams_bath = 0;
-				pingraw->beamflag = NULL;
-				pingraw->bath = NULL;
-				pingraw->bathacrosstrack = NULL;
-				pingraw->bathalongtrack = NULL;
-				}
-
-			/* initialize contour controls */
-			tick_len_map = MAX(section->lonmax - section->lonmin,
-						section->latmax - section->latmin) / 500;
-			label_hgt_map = MAX(section->lonmax - section->lonmin,
-						section->latmax - section->latmin) / 100;
- 			status = mb_contour_init(mbna_verbose, (struct swath **)swath_ptr,
-					    num_pings,
-					    beams_bath,
-					    mbna_contour_algorithm,
-					    MB_YES,MB_NO,MB_NO,MB_NO,MB_NO,
-					    project.cont_int, project.col_int,
-					    project.tick_int, project.label_int,
-					    tick_len_map, label_hgt_map, 0.0,
-					    mbna_ncolor, 0, NULL, NULL, NULL,
-					    0.0, 0.0, 0.0, 0.0,
-					    0, 0, 0.0, 0.0,
-					    &mbnavadjust_plot,
-					    &mbnavadjust_newpen,
-					    &mbnavadjust_setline,
-					    &mbnavadjust_justify_string,
-					    &mbnavadjust_plot_string,					    
-					    &error);
-			swath = (struct swath *) *swath_ptr;
-			swath->beams_bath = beams_bath;
-			swath->npings = 0;
+		/* allocate memory for data arrays */
+		if (status == MB_SUCCESS && cached == MB_NO)
+			{
+			/* get mb_io_ptr */
+			imb_io_ptr = (struct mb_io_struct *) imbio_ptr;
 
-			/* if error initializing memory then quit */
-			if (error != MB_ERROR_NO_ERROR)
+			/* initialize data storage */
+			status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, sizeof(struct swathraw),
+						(void **)swathraw_ptr, &error);
+			swathraw = (struct swathraw *) *swathraw_ptr;
+			swathraw->beams_bath = beams_bath;
+			swathraw->npings_max = num_pings;
+			swathraw->npings = 0;
+			status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, num_pings * sizeof(struct pingraw),
+						(void **)&swathraw->pingraws, &error);
+			for (i=0;i<swathraw->npings_max;i++)
 				{
-				mb_error(mbna_verbose,error,&error_message);
-				fprintf(stderr,"\nMBIO Error allocating contour control structure:\n%s\n",error_message);
-				fprintf(stderr,"\nProgram <%s> Terminated\n",
-					program_name);
-				exit(error);
+				pingraw = &swathraw->pingraws[i];
+				pingraw->beams_bath = 0;
+				pingraw->beamflag = NULL;
+				pingraw->bath = NULL;
+				pingraw->bathacrosstrack = NULL;
+				pingraw->bathalongtrack = NULL;
 				}
 			}
 
 		/* now read the data */
-		if (status == MB_SUCCESS)
+		if (status == MB_SUCCESS && cached == MB_NO)
 			{
 			done = MB_NO;
 			while (done == MB_NO)
@@ -7107,28 +7685,6 @@ int mbnavadjust_section_load(int file_id, int section_id, void **swathraw_ptr, v
 				status = mb_mallocd(mbna_verbose, __FILE__, __LINE__, beams_bath * sizeof(double),
 							(void **)&pingraw->bathalongtrack, &error);
 
-				/* make sure enough memory is allocated for contouring arrays */
-		        	ping = &swath->pings[swathraw->npings];
-				if (ping->beams_bath_alloc < beams_bath)
-					{
-					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(char),
-							(void **)&(ping->beamflag),&error);
-					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
-							(void **)&(ping->bath),&error);
-					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
-							(void **)&(ping->bathlon),&error);
-					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
-							(void **)&(ping->bathlat),&error);
-                                        if (mbna_contour_algorithm == MB_CONTOUR_OLD)
-                                            {
-                                            status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(int),
-                                                            (void **)&(ping->bflag[0]),&error);
-                                            status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(int),
-                                                            (void **)&(ping->bflag[1]),&error);
-                                            }
-					ping->beams_bath_alloc = beams_bath;
-					}
-
 			    	/* copy arrays and update bookkeeping */
 			    	if (error == MB_ERROR_NO_ERROR)
 				    {
@@ -7222,6 +7778,76 @@ ping->navlon, ping->navlat, beams_bath, swath->beams_bath);*/
 
 			/* close the input data file */
 			status = mb_close(mbna_verbose,&imbio_ptr,&error);
+
+			/* keep the raw data for later crossings */
+			mbnavadjust_section_cache_put(file_id, section_id, swathraw);
+			}
+
+		/* initialize contour controls */
+		if (status == MB_SUCCESS)
+			{
+			beams_bath = swathraw->beams_bath;
+			tick_len_map = MAX(section->lonmax - section->lonmin,
+						section->latmax - section->latmin) / 500;
+			label_hgt_map = MAX(section->lonmax - section->lonmin,
+						section->latmax - section->latmin) / 100;
+ 			status = mb_contour_init(mbna_verbose, (struct swath **)swath_ptr,
+					    num_pings,
+					    beams_bath,
+					    mbna_contour_algorithm,
+					    MB_YES,MB_NO,MB_NO,MB_NO,MB_NO,
+					    project.cont_int, project.col_int,
+					    project.tick_int, project.label_int,
+					    tick_len_map, label_hgt_map, 0.0,
+					    mbna_ncolor, 0, NULL, NULL, NULL,
+					    0.0, 0.0, 0.0, 0.0,
+					    0, 0, 0.0, 0.0,
+					    &mbnavadjust_plot,
+					    &mbnavadjust_newpen,
+					    &mbnavadjust_setline,
+					    &mbnavadjust_justify_string,
+					    &mbnavadjust_plot_string,
+					    &error);
+			swath = (struct swath *) *swath_ptr;
+			swath->beams_bath = beams_bath;
+			swath->npings = 0;
+
+			/* if error initializing memory then quit */
+			if (error != MB_ERROR_NO_ERROR)
+				{
+				mb_error(mbna_verbose,error,&error_message);
+				fprintf(stderr,"\nMBIO Error allocating contour control structure:\n%s\n",error_message);
+				fprintf(stderr,"\nProgram <%s> Terminated\n",
+					program_name);
+				exit(error);
+				}
+
+			/* make sure enough memory is allocated for contouring arrays */
+			for (iping=0;iping<swathraw->npings;iping++)
+				{
+				pingraw = &swathraw->pingraws[iping];
+		        	ping = &swath->pings[iping];
+				if (ping->beams_bath_alloc < pingraw->beams_bath)
+					{
+					beams_bath = pingraw->beams_bath;
+					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(char),
+							(void **)&(ping->beamflag),&error);
+					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
+							(void **)&(ping->bath),&error);
+					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
+							(void **)&(ping->bathlon),&error);
+					status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(double),
+							(void **)&(ping->bathlat),&error);
+                                        if (mbna_contour_algorithm == MB_CONTOUR_OLD)
+                                            {
+                                            status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(int),
+                                                            (void **)&(ping->bflag[0]),&error);
+                                            status = mb_reallocd(mbna_verbose,__FILE__,__LINE__,beams_bath*sizeof(int),
+                                                            (void **)&(ping->bflag[1]),&error);
+                                            }
+					ping->beams_bath_alloc = beams_bath;
+					}
+				}
 			}
    		}
 
@@ -7239,6 +7865,208 @@ ping->navlon, ping->navlat, beams_bath, swath->beams_bath);*/
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mbnavadjust_section_cache_get(int file_id, int section_id, void **swathraw_ptr)
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_section_cache_get";
+	int	status = MB_SUCCESS;
+	int	i;
+
+ 	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       file_id:      %d\n",file_id);
+		fprintf(stderr,"dbg2       section_id:   %d\n",section_id);
+		}
+
+	/* look for the section in the cache */
+	status = MB_FAILURE;
+	for (i=0;i<section_cache_num && status == MB_FAILURE;i++)
+		{
+		if (section_cache[i].file_id == file_id
+			&& section_cache[i].section_id == section_id)
+			{
+			section_cache_use++;
+			section_cache[i].last_use = section_cache_use;
+			*swathraw_ptr = (void *) section_cache[i].swathraw;
+			status = MB_SUCCESS;
+			}
+		}
+
+ 	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       swathraw_ptr: %p\n",*swathraw_ptr);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_section_cache_put(int file_id, int section_id, void *swathraw_ptr)
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_section_cache_put";
+	int	status = MB_SUCCESS;
+	int	icache;
+	int	i;
+
+ 	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       file_id:      %d\n",file_id);
+		fprintf(stderr,"dbg2       section_id:   %d\n",section_id);
+		fprintf(stderr,"dbg2       swathraw_ptr: %p\n",swathraw_ptr);
+		}
+
+	/* use an empty slot if there is one, otherwise replace the least
+		recently used section that is not part of the loaded crossing */
+	icache = -1;
+	if (section_cache_num < MBNA_SECTION_CACHE_MAX)
+		{
+		icache = section_cache_num;
+		section_cache_num++;
+		}
+	else
+		{
+		for (i=0;i<section_cache_num;i++)
+			{
+			if (section_cache[i].swathraw != swathraw1
+				&& section_cache[i].swathraw != swathraw2
+				&& (icache < 0
+					|| section_cache[i].last_use < section_cache[icache].last_use))
+				icache = i;
+			}
+		if (icache >= 0)
+			mbnavadjust_section_cache_free(section_cache[icache].swathraw);
+		}
+
+	/* add the section */
+	if (icache >= 0)
+		{
+		section_cache_use++;
+		section_cache[icache].file_id = file_id;
+		section_cache[icache].section_id = section_id;
+		section_cache[icache].last_use = section_cache_use;
+		section_cache[icache].swathraw = (struct swathraw *) swathraw_ptr;
+		}
+	else
+		status = MB_FAILURE;
+
+ 	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       icache:      %d\n",icache);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_section_cache_clear()
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_section_cache_clear";
+	int	status = MB_SUCCESS;
+	int	i;
+
+ 	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		}
+
+	/* free all cached sections */
+	for (i=0;i<section_cache_num;i++)
+		{
+		if (section_cache[i].swathraw == swathraw1)
+			swathraw1 = NULL;
+		if (section_cache[i].swathraw == swathraw2)
+			swathraw2 = NULL;
+		mbnavadjust_section_cache_free(section_cache[i].swathraw);
+		section_cache[i].swathraw = NULL;
+		}
+	section_cache_num = 0;
+	section_cache_use = 0;
+
+ 	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:       %d\n",error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbnavadjust_section_cache_free(void *swathraw_ptr)
+{
+	/* local variables */
+	char	*function_name = "mbnavadjust_section_cache_free";
+	int	status = MB_SUCCESS;
+	struct swathraw *swathraw;
+	struct pingraw *pingraw;
+   	int	i;
+
+ 	/* print input debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       swathraw_ptr: %p\n",swathraw_ptr);
+		}
+
+	/* free raw swath data */
+	swathraw = (struct swathraw *) swathraw_ptr;
+	if (swathraw != NULL && swathraw->pingraws != NULL)
+	    {
+	    for (i=0;i<swathraw->npings_max;i++)
+		{
+		pingraw = &swathraw->pingraws[i];
+		status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->beamflag, &error);
+		status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bath, &error);
+		status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathacrosstrack, &error);
+		status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&pingraw->bathalongtrack, &error);
+		}
+	    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw->pingraws, &error);
+	    }
+	if (swathraw != NULL)
+	    status = mb_freed(mbna_verbose,__FILE__,__LINE__,(void **)&swathraw, &error);
+
+ 	/* print output debug statements */
+	if (mbna_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBnavadjust function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:       %d\n",error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 int mbnavadjust_section_translate(int file_id, void *swathraw_ptr, void *swath_ptr, double zoffset)
 {
 	/* local variables */
@@ -10816,9 +11644,22 @@ i,file->block,file->block_offset_x,file->block_offset_y,file->block_offset_z); *
 				x[ndf * inav] = 0.0;
 				x[ndf * inav + 1] = 0.0;
 				x[ndf * inav + 2] = 0.0;
-				xx[ndf * inav] = 0.0;
-				xx[ndf * inav + 1] = 0.0;
-				xx[ndf * inav + 2] = 0.0;
+
+				/* hold any previous solution in xx until the
+					average model is known so that the
+					inversion can start from it */
+				if (project.inversion != MBNA_INVERSION_NONE)
+				    {
+				    xx[ndf * inav] = section->snav_lon_offset[isnav] / mbna_mtodeglon;
+				    xx[ndf * inav + 1] = section->snav_lat_offset[isnav] / mbna_mtodeglat;
+				    xx[ndf * inav + 2] = section->snav_z_offset[isnav];
+				    }
+				else
+				    {
+				    xx[ndf * inav] = 0.0;
+				    xx[ndf * inav + 1] = 0.0;
+				    xx[ndf * inav + 2] = 0.0;
+				    }
 				xa[ndf * inav] = file->block_offset_x - block_offset_avg_x;
 				xa[ndf * inav + 1] = file->block_offset_y - block_offset_avg_y;
 				xa[ndf * inav + 2] = file->block_offset_z - block_offset_avg_z;
@@ -11521,6 +12362,16 @@ i,j,isnav,k,x[3*k+2],xa[3*k+2],section->snav_z_offset[isnav]); */
 		/* Step 3 - invert for model satisfying all nav ties              */
 		/*----------------------------------------------------------------*/
 
+		/* start from the previous solution if there is one - the ties
+			usually change little between inversions, so this converges
+			in far fewer iterations than starting from the average model */
+		for (i=0;i<ncols;i++)
+		    {
+		    if (project.inversion != MBNA_INVERSION_NONE)
+			x[i] = xx[i] - xa[i];
+		    xx[i] = 0.0;
+		    }
+
 		/* loop until convergence */
 		done = MB_NO;
 		iter = 0;
@@ -13036,6 +13887,10 @@ iter,nmisfit,misfit_initial,misfit_ties_initial,misfit_ties,misfit_norm_initial,
 		        iter++;
 		    	}
 
+		    /* save and interpolate the solution only when it is
+		    	about to be plotted or the inversion is finished */
+		    if (done == MB_YES || (project.modelplot == MB_YES && iter % 25 == 0))
+		    {
 		    /* save solution */
 		    k = 0;
 		    for (i=0;i<project.num_files;i++)
@@ -13083,6 +13938,7 @@ isnav,k,x[3*k+2],xa[3*k+2],section->snav_lat_offset[isnav]); */
 				}
 			    }
 			}
+		    }
 
 		    /* set message dialog on */
 		    if (iter % 100 == 0)
@@ -521,6 +521,16 @@ int mb3dsoundings_end(int verbose, int *error)
 	    mb3dsoundings.init = MBS_WINDOW_NULL;
 	    }
 
+	/* deallocate vertex array buffers */
+	if (mb3dsoundings.num_vertex_alloc > 0)
+	    {
+	    mb_freed(mbs_verbose, __FILE__, __LINE__, (void **)&mb3dsoundings.vertex_colors, error);
+	    mb_freed(mbs_verbose, __FILE__, __LINE__, (void **)&mb3dsoundings.index_unflagged, error);
+	    mb_freed(mbs_verbose, __FILE__, __LINE__, (void **)&mb3dsoundings.index_flagged, error);
+	    mb_freed(mbs_verbose, __FILE__, __LINE__, (void **)&mb3dsoundings.index_profile_unflagged, error);
+	    mb_freed(mbs_verbose, __FILE__, __LINE__, (void **)&mb3dsoundings.index_profile_flagged, error);
+	    }
+
 	/* reinitialize parameters */
 	mb3dsoundings_reset();
 
@@ -880,6 +890,19 @@ int mb3dsoundings_reset()
 	mb3dsoundings.last_sounding_defined = MB_NO;
 	mb3dsoundings.last_sounding_edited = 0;
 
+	/* vertex array buffers */
+	mb3dsoundings.num_vertex_alloc = 0;
+	mb3dsoundings.vertex_colors = NULL;
+	mb3dsoundings.index_unflagged = NULL;
+	mb3dsoundings.index_flagged = NULL;
+	mb3dsoundings.index_profile_unflagged = NULL;
+	mb3dsoundings.index_profile_flagged = NULL;
+	mb3dsoundings.num_index_unflagged = 0;
+	mb3dsoundings.num_index_flagged = 0;
+	mb3dsoundings.num_index_profile_unflagged = 0;
+	mb3dsoundings.num_index_profile_flagged = 0;
+	mb3dsoundings.buffers_dirty = MB_YES;
+
 	/* print output debug statements */
 	if (mbs_verbose >= 2)
 		{
@@ -922,6 +945,7 @@ int mb3dsoundings_open(int verbose, struct mb3dsoundings_struct *soundingdata, i
 
 	/* set the data pointer */
 	mb3dsoundings.soundingdata = (struct mb3dsoundings_struct *)soundingdata;
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_scale(verbose, error);
 
 	/* if not yet created then create the MB3DView class in
@@ -2024,6 +2048,7 @@ mb3dsoundings_pick(int x, int y)
 	/* replot the data */
 	if (editevent == MB_YES)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
 		}
@@ -2108,6 +2133,7 @@ i,sounding->ifile, sounding->iping,sounding->ibeam, sounding->beamflag,MB3DSDG_E
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2207,6 +2233,7 @@ mb3dsoundings_grab(int x, int y, int grabmode)
 		/* replot and flush the edit events in the calling application */
 		if (neditevent > 0)
 			{
+			mb3dsoundings.buffers_dirty = MB_YES;
 			/* replot the data */
 			mb3dsoundings_plot(mbs_verbose, &mbs_error);
 			mb3dsoundings_updatestatus();
@@ -2261,6 +2288,7 @@ mb3dsoundings_unflag_view()
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2314,6 +2342,7 @@ mb3dsoundings_flag_view()
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2427,6 +2456,7 @@ mb3dsoundings.last_sounding_defined, mb3dsoundings.last_sounding_edited); */
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2492,6 +2522,7 @@ mb3dsoundings.last_sounding_defined, mb3dsoundings.last_sounding_edited); */
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2553,6 +2584,7 @@ mb3dsoundings.last_sounding_defined, mb3dsoundings.last_sounding_edited); */
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2618,6 +2650,7 @@ mb3dsoundings.last_sounding_defined, mb3dsoundings.last_sounding_edited); */
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2686,6 +2719,7 @@ mb3dsoundings.last_sounding_defined, mb3dsoundings.last_sounding_edited); */
 	/* replot and flush the edit events in the calling application */
 	if (neditevent > 0)
 		{
+		mb3dsoundings.buffers_dirty = MB_YES;
 		/* replot the data */
 		mb3dsoundings_plot(mbs_verbose, &mbs_error);
 		mb3dsoundings_updatestatus();
@@ -2774,6 +2808,136 @@ mb3dsoundings_setzscale(int verbose, int *error)
 
 /*---------------------------------------------------------------------------------------*/
 
+int
+mb3dsoundings_updatebuffers(int verbose, int *error)
+{
+	/* local variables */
+	char	*function_name = "mb3dsoundings_updatebuffers";
+
+	struct mb3dsoundings_struct *soundingdata;
+	struct mb3dsoundings_sounding_struct *sounding;
+	struct mb3dsoundings_sounding_struct *sounding2;
+	size_t	size;
+	int	i;
+
+	/* print starting debug statements */
+	if (mbs_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Version %s\n",rcs_id);
+		fprintf(stderr,"dbg2  MB-system Version %s\n",MB_VERSION);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:                 %d\n", verbose);
+		}
+
+	/* get sounding data structure */
+	soundingdata = (struct mb3dsoundings_struct *) mb3dsoundings.soundingdata;
+	mbs_status = MB_SUCCESS;
+	mbs_error = MB_ERROR_NO_ERROR;
+
+	/* allocate buffers large enough for all of the soundings */
+	if (soundingdata->num_soundings > mb3dsoundings.num_vertex_alloc)
+		{
+		size = soundingdata->num_soundings;
+		mbs_status = mb_reallocd(mbs_verbose, __FILE__, __LINE__, 3 * size * sizeof(GLubyte),
+					(void **)&mb3dsoundings.vertex_colors, &mbs_error);
+		if (mbs_status == MB_SUCCESS)
+		mbs_status = mb_reallocd(mbs_verbose, __FILE__, __LINE__, size * sizeof(GLuint),
+					(void **)&mb3dsoundings.index_unflagged, &mbs_error);
+		if (mbs_status == MB_SUCCESS)
+		mbs_status = mb_reallocd(mbs_verbose, __FILE__, __LINE__, size * sizeof(GLuint),
+					(void **)&mb3dsoundings.index_flagged, &mbs_error);
+		if (mbs_status == MB_SUCCESS)
+		mbs_status = mb_reallocd(mbs_verbose, __FILE__, __LINE__, 2 * size * sizeof(GLuint),
+					(void **)&mb3dsoundings.index_profile_unflagged, &mbs_error);
+		if (mbs_status == MB_SUCCESS)
+		mbs_status = mb_reallocd(mbs_verbose, __FILE__, __LINE__, 2 * size * sizeof(GLuint),
+					(void **)&mb3dsoundings.index_profile_flagged, &mbs_error);
+		if (mbs_status == MB_SUCCESS)
+			mb3dsoundings.num_vertex_alloc = soundingdata->num_soundings;
+		}
+
+	/* fill the color and index buffers in a single pass - the vertices
+		themselves are drawn directly from the sounding structures */
+	mb3dsoundings.num_index_unflagged = 0;
+	mb3dsoundings.num_index_flagged = 0;
+	mb3dsoundings.num_index_profile_unflagged = 0;
+	mb3dsoundings.num_index_profile_flagged = 0;
+	if (mbs_status == MB_SUCCESS)
+		{
+		for (i=0;i<soundingdata->num_soundings;i++)
+			{
+			sounding = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i]);
+			if (mb_beam_ok(sounding->beamflag))
+				{
+				mb3dsoundings.vertex_colors[3*i]
+					= (GLubyte) (255.0 * colortable_object_red[sounding->beamcolor] + 0.5);
+				mb3dsoundings.vertex_colors[3*i+1]
+					= (GLubyte) (255.0 * colortable_object_green[sounding->beamcolor] + 0.5);
+				mb3dsoundings.vertex_colors[3*i+2]
+					= (GLubyte) (255.0 * colortable_object_blue[sounding->beamcolor] + 0.5);
+				mb3dsoundings.index_unflagged[mb3dsoundings.num_index_unflagged] = i;
+				mb3dsoundings.num_index_unflagged++;
+				}
+			else
+				{
+				mb3dsoundings.vertex_colors[3*i] = 255;
+				mb3dsoundings.vertex_colors[3*i+1] = 0;
+				mb3dsoundings.vertex_colors[3*i+2] = 0;
+				mb3dsoundings.index_flagged[mb3dsoundings.num_index_flagged] = i;
+				mb3dsoundings.num_index_flagged++;
+				}
+
+			/* profile segments join soundings from the same ping */
+			if (i < soundingdata->num_soundings - 1)
+				{
+				sounding2 = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i+1]);
+				if (sounding2->ifile == sounding->ifile && sounding->iping == sounding2->iping)
+					{
+					if (mb_beam_ok(sounding->beamflag) && mb_beam_ok(sounding2->beamflag))
+						{
+						mb3dsoundings.index_profile_unflagged[mb3dsoundings.num_index_profile_unflagged] = i;
+						mb3dsoundings.index_profile_unflagged[mb3dsoundings.num_index_profile_unflagged+1] = i + 1;
+						mb3dsoundings.num_index_profile_unflagged += 2;
+						}
+					else
+						{
+						mb3dsoundings.index_profile_flagged[mb3dsoundings.num_index_profile_flagged] = i;
+						mb3dsoundings.index_profile_flagged[mb3dsoundings.num_index_profile_flagged+1] = i + 1;
+						mb3dsoundings.num_index_profile_flagged += 2;
+						}
+					}
+				}
+			}
+		mb3dsoundings.buffers_dirty = MB_NO;
+		}
+
+	/* set error */
+	*error = mbs_error;
+
+	/* print output debug statements */
+	if (mbs_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       num_index_unflagged:         %d\n",mb3dsoundings.num_index_unflagged);
+		fprintf(stderr,"dbg2       num_index_flagged:           %d\n",mb3dsoundings.num_index_flagged);
+		fprintf(stderr,"dbg2       num_index_profile_unflagged: %d\n",mb3dsoundings.num_index_profile_unflagged);
+		fprintf(stderr,"dbg2       num_index_profile_flagged:   %d\n",mb3dsoundings.num_index_profile_flagged);
+		fprintf(stderr,"dbg2       error:        %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:       %d\n",mbs_status);
+		}
+
+	/* return */
+	return(mbs_status);
+
+}
+
+/*---------------------------------------------------------------------------------------*/
+
 int
 mb3dsoundings_plot(int verbose, int *error)
 {
@@ -2782,14 +2946,14 @@ mb3dsoundings_plot(int verbose, int *error)
 
 	struct mb3dsoundings_struct *soundingdata;
 	struct mb3dsoundings_sounding_struct *sounding;
-	struct mb3dsoundings_sounding_struct *sounding2;
 	GLdouble 	model_matrix[16];
 	GLdouble 	projection_matrix[16];
 	GLint	viewport[4];
 	int		grabxmin, grabxmax, grabymin, grabymax;
 	float	glxmin, glymin, glzmin, glxmax, glymax, glzmax;
-	double	xx, yy, zz;
-	int	i;
+	GLdouble	pm_matrix[16];
+	double	xx, yy, ww;
+	int	i, j, k, l;
 
 	/* print starting debug statements */
 	if (mbs_verbose >= 2)
@@ -2977,74 +3141,54 @@ mbview_glerrorcheck(0, __FILE__, __LINE__, function_name);
 		glDisable(GL_LINE_STIPPLE);
 		}
 
-	/* Plot the profiles if desired */
-	if (mb3dsoundings.view_profiles != MBS_VIEW_PROFILES_NONE)
-		{
-		glLineWidth(1.0);
-		glBegin(GL_LINES);
-		for (i=0;i<soundingdata->num_soundings-1;i++)
-			{
-			sounding = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i]);
-			sounding2 = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i+1]);
+	/* update the vertex array buffers only if the soundings, their
+		flags, or their colors have changed since the last redraw */
+	if (mb3dsoundings.buffers_dirty == MB_YES)
+		mb3dsoundings_updatebuffers(verbose, error);
 
-			/* plot segment only if soundings are from the same ping */
-			if (sounding2->ifile == sounding->ifile && sounding->iping == sounding2->iping)
-				{
-				/* plot in black if both soundings are good */
-				if (mb_beam_ok(sounding->beamflag) && mb_beam_ok(sounding2->beamflag))
-					{
-					glColor3f(0.0, 0.0, 0.0);
-					glVertex3f(sounding->glx, sounding->gly, sounding->glz);
-					glVertex3f(sounding2->glx, sounding2->gly, sounding2->glz);
-					}
-
-				/* else plot in red if flagged profiles are desired */
-				else if (mb3dsoundings.view_profiles == MBS_VIEW_PROFILES_ALL)
-					{
-					glColor3f(1.0, 0.0, 0.0);
-					glVertex3f(sounding->glx, sounding->gly, sounding->glz);
-					glVertex3f(sounding2->glx, sounding2->gly, sounding2->glz);
-					}
-				}
-			}
-		glEnd();
-		}
-
-	/* Plot the unflagged soundings */
-	glPointSize(3.0);
-	glColor3f(0.0, 0.0, 0.0);
-	glBegin(GL_POINTS);
-	for (i=0;i<soundingdata->num_soundings;i++)
+	/* draw the soundings and profiles as vertex arrays read directly
+		from the sounding structures rather than one vertex at a time */
+	if (soundingdata->num_soundings > 0
+		&& mb3dsoundings.num_vertex_alloc >= soundingdata->num_soundings)
 		{
-		sounding = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i]);
-/*fprintf(stderr,"%d %f %f %f  %f %f %f %d", i,
-sounding->x, sounding->y, sounding->z,
-sounding->glx, sounding->gly, sounding->glz, sounding->beamflag);*/
-		if (mb_beam_ok(sounding->beamflag))
-			{
-			glColor3f(colortable_object_red[sounding->beamcolor],
-				colortable_object_green[sounding->beamcolor],
-				colortable_object_blue[sounding->beamcolor]);
-			glVertex3f(sounding->glx, sounding->gly, sounding->glz);
-			/* fprintf(stderr," PLOTTED");*/
-			}
-/*fprintf(stderr,"\n");*/
-		}
-	glEnd();
+		glEnableClientState(GL_VERTEX_ARRAY);
+		glVertexPointer(3, GL_FLOAT, sizeof(struct mb3dsoundings_sounding_struct),
+				&(soundingdata->soundings[0].glx));
 
-	/* Plot the flagged soundings if desired */
-	if (mb3dsoundings.view_flagged == MB_YES)
-		{
-		glColor3f(1.0, 0.0, 0.0);
-		glBegin(GL_POINTS);
-		for (i=0;i<soundingdata->num_soundings;i++)
+		/* Plot the profiles if desired */
+		if (mb3dsoundings.view_profiles != MBS_VIEW_PROFILES_NONE)
 			{
-			sounding = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i]);
-			if (!mb_beam_ok(sounding->beamflag))
-				glVertex3f(sounding->glx, sounding->gly, sounding->glz);
-/*fprintf(stderr,"%f %f %f\n", sounding->glx, sounding->gly, sounding->glz);*/
+			glLineWidth(1.0);
+
+			/* plot in black if both soundings are good */
+			glColor3f(0.0, 0.0, 0.0);
+			if (mb3dsoundings.num_index_profile_unflagged > 0)
+				glDrawElements(GL_LINES, mb3dsoundings.num_index_profile_unflagged,
+						GL_UNSIGNED_INT, mb3dsoundings.index_profile_unflagged);
+
+			/* else plot in red if flagged profiles are desired */
+			glColor3f(1.0, 0.0, 0.0);
+			if (mb3dsoundings.view_profiles == MBS_VIEW_PROFILES_ALL
+				&& mb3dsoundings.num_index_profile_flagged > 0)
+				glDrawElements(GL_LINES, mb3dsoundings.num_index_profile_flagged,
+						GL_UNSIGNED_INT, mb3dsoundings.index_profile_flagged);
 			}
-		glEnd();
+
+		/* Plot the unflagged soundings */
+		glPointSize(3.0);
+		glEnableClientState(GL_COLOR_ARRAY);
+		glColorPointer(3, GL_UNSIGNED_BYTE, 0, mb3dsoundings.vertex_colors);
+		if (mb3dsoundings.num_index_unflagged > 0)
+			glDrawElements(GL_POINTS, mb3dsoundings.num_index_unflagged,
+					GL_UNSIGNED_INT, mb3dsoundings.index_unflagged);
+
+		/* Plot the flagged soundings if desired */
+		if (mb3dsoundings.view_flagged == MB_YES
+			&& mb3dsoundings.num_index_flagged > 0)
+			glDrawElements(GL_POINTS, mb3dsoundings.num_index_flagged,
+					GL_UNSIGNED_INT, mb3dsoundings.index_flagged);
+		glDisableClientState(GL_COLOR_ARRAY);
+		glDisableClientState(GL_VERTEX_ARRAY);
 		}
 
 	/* If in info mode and sounding picked plot it green */
@@ -3058,24 +3202,30 @@ sounding->glx, sounding->gly, sounding->glz, sounding->beamflag);*/
 		glEnd();
 		}
 
-	/* save the screen positions of the soundings to facillitate picking */
+	/* save the screen positions of the soundings to facillitate picking -
+		this is the same transformation as gluProject() but with the
+		projection and modelview matrices combined once for all soundings */
+	for (j=0;j<4;j++)
+		for (k=0;k<4;k++)
+			{
+			pm_matrix[4*j+k] = 0.0;
+			for (l=0;l<4;l++)
+				pm_matrix[4*j+k] += projection_matrix[4*l+k] * model_matrix[4*j+l];
+			}
 	for (i=0;i<soundingdata->num_soundings;i++)
 		{
 		sounding = (struct mb3dsoundings_sounding_struct *) &(soundingdata->soundings[i]);
-		if (mb_beam_ok(sounding->beamflag))
+		ww = pm_matrix[3] * sounding->glx + pm_matrix[7] * sounding->gly
+			+ pm_matrix[11] * sounding->glz + pm_matrix[15];
+		if (ww != 0.0)
 			{
-			glVertex3f(sounding->glx, sounding->gly, sounding->glz);
-			/* fprintf(stderr," PLOTTED");*/
+			xx = (pm_matrix[0] * sounding->glx + pm_matrix[4] * sounding->gly
+				+ pm_matrix[8] * sounding->glz + pm_matrix[12]) / ww;
+			yy = (pm_matrix[1] * sounding->glx + pm_matrix[5] * sounding->gly
+				+ pm_matrix[9] * sounding->glz + pm_matrix[13]) / ww;
+			sounding->winx = (int)(viewport[0] + 0.5 * (1.0 + xx) * viewport[2]);
+			sounding->winy = (int)(viewport[1] + 0.5 * (1.0 + yy) * viewport[3]);
 			}
-		gluProject((double)(sounding->glx),
-			(double)(sounding->gly),
-			(double)(sounding->glz),
-			model_matrix,
-			projection_matrix,
-			viewport,
-			&xx, &yy, &zz);
-		sounding->winx = (int)xx;
-		sounding->winy = (int)yy;
 		}
 
 	/* plot grab rectangle before rotations */
@@ -3520,6 +3670,7 @@ do_mb3dsdg_action_colorsoundingsblack( Widget w, XtPointer client_data, XtPointe
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_BLACK);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3538,6 +3689,7 @@ do_mb3dsdg_action_colorsoundingsred( Widget w, XtPointer client_data, XtPointer
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_RED);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3556,6 +3708,7 @@ do_mb3dsdg_action_colorsoundingsyellow( Widget w, XtPointer client_data, XtPoint
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_YELLOW);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3574,6 +3727,7 @@ do_mb3dsdg_action_colorsoundingsgreen( Widget w, XtPointer client_data, XtPointe
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_GREEN);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3592,6 +3746,7 @@ do_mb3dsdg_action_colorsoundingsbluegreen( Widget w, XtPointer client_data, XtPo
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_BLUEGREEN);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3610,6 +3765,7 @@ do_mb3dsdg_action_colorsoundingsblue( Widget w, XtPointer client_data, XtPointer
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_BLUE);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -3628,6 +3784,7 @@ do_mb3dsdg_action_colorsoundingspurple( Widget w, XtPointer client_data, XtPoint
 	(mb3dsoundings.mb3dsoundings_colorsoundings_notify)(MBV_COLOR_PURPLE);
 
 	/* replot the data */
+	mb3dsoundings.buffers_dirty = MB_YES;
 	mb3dsoundings_plot(mbs_verbose, &mbs_error);
 }
 
@@ -192,6 +192,20 @@ struct mb3dsoundings_world_struct
     /* last sounding edited */
     int	last_sounding_defined;
     int	last_sounding_edited;
+
+    /* vertex array buffers used to draw the soundings - the vertices
+	are read in place from the sounding structures */
+    int	num_vertex_alloc;
+    GLubyte *vertex_colors;
+    GLuint *index_unflagged;
+    GLuint *index_flagged;
+    GLuint *index_profile_unflagged;
+    GLuint *index_profile_flagged;
+    int	num_index_unflagged;
+    int	num_index_flagged;
+    int	num_index_profile_unflagged;
+    int	num_index_profile_flagged;
+    int	buffers_dirty;
     };
 
 /* library variables */
@@ -265,6 +279,7 @@ void do_mb3dsdg_glwda_resize( Widget w, XtPointer client_data, XtPointer call_da
 int mb3dsoundings_setzscale(int verbose, int *error);
 int mb3dsoundings_scale(int verbose, int *error);
 int mb3dsoundings_scalez(int verbose, int *error);
+int mb3dsoundings_updatebuffers(int verbose, int *error);
 int mb3dsoundings_pick(int x, int y);
 int mb3dsoundings_eraserestore(int x, int y);
 int mb3dsoundings_grab(int x, int y, int grabmode);
@@ -683,6 +683,8 @@ int mbview_reset(size_t instance)
 		data->primary_b = NULL;
 		data->primary_stat_color = NULL;
 		data->primary_stat_z = NULL;
+		view->primary_basecolor = NULL;
+		view->primary_stat_basecolor = NULL;
 		data->secondary_sameas_primary = MB_NO;
 		data->secondary_nodatavalue = MBV_DEFAULT_NODATA;
 		data->secondary_nxy = 0;
@@ -4346,7 +4348,7 @@ event->xbutton.x,event->xbutton.y, data->mouse_mode);*/
 
 			/* clear color status array */
 			mbview_setcolorparms(instance);
-			mbview_colorclear(instance);
+			mbview_shadeclear(instance);
 
 			/* replot */
 			mbview_plotlow(instance);
@@ -4573,7 +4575,7 @@ event->xbutton.x,event->xbutton.y, data->mouse_mode);*/
 
 			/* clear color status array */
 			mbview_setcolorparms(instance);
-			mbview_colorclear(instance);
+			mbview_shadeclear(instance);
 
 			/* replot */
 			mbview_plotlow(instance);
@@ -4598,7 +4600,7 @@ event->xbutton.x,event->xbutton.y, data->mouse_mode);*/
 
 			/* clear color status array */
 			mbview_setcolorparms(instance);
-			mbview_colorclear(instance);
+			mbview_shadeclear(instance);
 
 			/* replot */
 			mbview_plotlow(instance);
@@ -4623,7 +4625,7 @@ event->xbutton.x,event->xbutton.y, data->mouse_mode);*/
 
 			/* clear color status array */
 			mbview_setcolorparms(instance);
-			mbview_colorclear(instance);
+			mbview_shadeclear(instance);
 
 			/* replot */
 			mbview_plotlow(instance);
@@ -5226,6 +5228,12 @@ mbview_glerrorcheck(instance, __FILE__, __LINE__, function_name);
      	    if (status == MB_SUCCESS
 		    && data->primary_stat_z != NULL)
    	    status = mb_freed(mbv_verbose, __FILE__, __LINE__, (void **)&data->primary_stat_z, error);
+     	    if (status == MB_SUCCESS
+		    && view->primary_basecolor != NULL)
+   	    status = mb_freed(mbv_verbose, __FILE__, __LINE__, (void **)&view->primary_basecolor, error);
+     	    if (status == MB_SUCCESS
+		    && view->primary_stat_basecolor != NULL)
+   	    status = mb_freed(mbv_verbose, __FILE__, __LINE__, (void **)&view->primary_stat_basecolor, error);
     	    if (status == MB_SUCCESS
 		    && data->secondary_data != NULL)
     	    status = mb_freed(mbv_verbose, __FILE__, __LINE__, (void **)&data->secondary_data, error);
@@ -5746,7 +5754,7 @@ fprintf(stderr,"do_mbview_overlay_none instance:%zu\n", instance);
 
     /* clear color status array */
     mbview_setcolorparms(instance);
-    mbview_colorclear(instance);
+    mbview_shadeclear(instance);
 
     /* draw */
 if (mbv_verbose >= 2)
@@ -5795,7 +5803,7 @@ fprintf(stderr,"do_mbview_overlay_slope instance:%zu\n", instance);
 
     /* clear color status array */
     mbview_setcolorparms(instance);
-    mbview_colorclear(instance);
+    mbview_shadeclear(instance);
 
     /* draw */
 if (mbv_verbose >= 2)
@@ -5844,7 +5852,7 @@ fprintf(stderr,"do_mbview_overlay_illumination instance:%zu\n", instance);
 
     /* clear color status array */
     mbview_setcolorparms(instance);
-    mbview_colorclear(instance);
+    mbview_shadeclear(instance);
 
     /* draw */
 if (mbv_verbose >= 2)
@@ -5893,7 +5901,7 @@ fprintf(stderr,"do_mbview_overlay_secondary instance:%zu\n", instance);
 
     /* clear color status array */
     mbview_setcolorparms(instance);
-    mbview_colorclear(instance);
+    mbview_shadeclear(instance);
 
     /* draw */
 if (mbv_verbose >= 2)
@@ -7552,6 +7560,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->primary_colortable_min)
 		{
 		data->primary_colortable_min = dvalue;
+		view->primary_histogram_set = MB_NO;
 		if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
 			change = MB_YES;
 		}
@@ -7561,6 +7570,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->primary_colortable_max)
 		{
 		data->primary_colortable_max = dvalue;
+		view->primary_histogram_set = MB_NO;
  		if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
 			change = MB_YES;
 		}
@@ -7573,9 +7583,6 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
     		view->contourlorez = MB_NO;
     		view->contourhirez = MB_NO;
     		view->contourfullrez = MB_NO;
-		view->primary_histogram_set = MB_NO;
-		view->primaryslope_histogram_set = MB_NO;
-		view->secondary_histogram_set = MB_NO;
  		if (data->grid_contour_mode == MBV_VIEW_ON)
 			change = MB_YES;
 		}
@@ -7593,6 +7600,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->slope_colortable_min)
 		{
 		data->slope_colortable_min = dvalue;
+		view->primaryslope_histogram_set = MB_NO;
 		if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
 			change = MB_YES;
 		}
@@ -7602,6 +7610,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->slope_colortable_max)
 		{
 		data->slope_colortable_max = dvalue;
+		view->primaryslope_histogram_set = MB_NO;
  		if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
 			change = MB_YES;
 		}
@@ -7619,6 +7628,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->secondary_colortable_min)
 		{
 		data->secondary_colortable_min = dvalue;
+		view->secondary_histogram_set = MB_NO;
 		if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
 			change = MB_YES;
 		}
@@ -7628,6 +7638,7 @@ fprintf(stderr,"do_mbview_colorboundsapply: instance:%zu\n", instance);
 	if (dvalue != data->secondary_colortable_max)
 		{
 		data->secondary_colortable_max = dvalue;
+		view->secondary_histogram_set = MB_NO;
  		if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
 			change = MB_YES;
 		}
@@ -7842,7 +7853,7 @@ fprintf(stderr,"do_mbview_shadeparmsapply: instance:%zu\n", instance);
 	    {
     	    view->lastdrawrez = MBV_REZ_NONE;
     	    mbview_setcolorparms(instance);
-	    mbview_colorclear(instance);
+	    mbview_shadeclear(instance);
 	    }
 
     /* draw */
@@ -182,6 +182,12 @@ int mbview_setprimarygrid(int verbose, size_t instance,
      	if (status == MB_SUCCESS)
    	status = mb_mallocd(verbose, __FILE__, __LINE__, (data->primary_nxy / 8) + 1,
     				(void **)&data->primary_stat_z, error);
+     	if (status == MB_SUCCESS)
+   	status = mb_mallocd(verbose, __FILE__, __LINE__, 3 * sizeof(float) * data->primary_nxy,
+    				(void **)&view->primary_basecolor, error);
+     	if (status == MB_SUCCESS)
+   	status = mb_mallocd(verbose, __FILE__, __LINE__, (data->primary_nxy / 8) + 1,
+    				(void **)&view->primary_stat_basecolor, error);
 	if (status != MB_SUCCESS)
 	    {
 	    fprintf(stderr,"\nUnable to allocate memory to store primary grid data\n");
@@ -324,7 +330,7 @@ int mbview_updateprimarygridcell(int verbose, size_t instance,
 	int	status = MB_SUCCESS;
 	struct mbview_world_struct *view;
 	struct mbview_struct *data;
-	int	k;
+	int	i, j, k;
 
 	/* print starting debug statements */
 	if (verbose >= 2)
@@ -353,10 +359,20 @@ int mbview_updateprimarygridcell(int verbose, size_t instance,
 		k = primary_ix * data->primary_ny + primary_jy;
 		data->primary_data[k] = value;
 		data->primary_stat_z[k/8] = data->primary_stat_z[k/8] & (255 - statmask[k%8]);
-		data->primary_stat_color[k/8] = data->primary_stat_color[k/8] & (255 - statmask[k%8]);
 
-		/* calculate new derivative */
-		mbview_derivative(instance, primary_ix, primary_jy);
+		/* calculate new derivatives for the cell and its neighbors,
+			and recolor just those cells */
+		for (i=MAX(primary_ix-1,0);i<=MIN(primary_ix+1,data->primary_nx-1);i++)
+		    for (j=MAX(primary_jy-1,0);j<=MIN(primary_jy+1,data->primary_ny-1);j++)
+			{
+			if (i == primary_ix || j == primary_jy)
+				{
+				k = i * data->primary_ny + j;
+				mbview_derivative(instance, i, j);
+				data->primary_stat_color[k/8] = data->primary_stat_color[k/8] & (255 - statmask[k%8]);
+				view->primary_stat_basecolor[k/8] = view->primary_stat_basecolor[k/8] & (255 - statmask[k%8]);
+				}
+			}
 
 		/* reset contour flags */
 		view->contourlorez = MB_NO;
@@ -640,7 +640,7 @@ fprintf(stderr,"mbview_derivative: %zu\n", instance);
 		&& data->primary_data[k2] != data->primary_nodatavalue)
 		derivative_ok = MB_YES;
 	    }
-	else if (i == data->primary_ny - 1)
+	else if (j == data->primary_ny - 1)
 	    {
 	    k1 = i * data->primary_ny + (j - 1);
 	    k2 = i * data->primary_ny + j;
@@ -2948,6 +2948,51 @@ fprintf(stderr,"mbview_colorclear: %zu\n", instance);
 
 	/* set status bit arrays */
 	view->colordonecount = 0;
+	if (data->primary_stat_color != NULL)
+		memset(data->primary_stat_color, 0, (data->primary_nxy / 8) + 1);
+	if (view->primary_stat_basecolor != NULL)
+		memset(view->primary_stat_basecolor, 0, (data->primary_nxy / 8) + 1);
+
+	/* print output debug statements */
+	if (mbv_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:      %d\n",status);
+		}
+
+	/* return */
+	return(status);
+}
+
+/*------------------------------------------------------------------------------*/
+int mbview_shadeclear(size_t instance)
+{
+	/* local variables */
+	char	*function_name = "mbview_shadeclear";
+	int	status = MB_SUCCESS;
+	struct mbview_world_struct *view;
+	struct mbview_struct *data;
+
+	/* print starting debug statements */
+	if (mbv_verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Version %s\n",rcs_id);
+		fprintf(stderr,"dbg2  MB-system Version %s\n",MB_VERSION);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       instance:         %zu\n",instance);
+		}
+
+	/* get view */
+	view = &(mbviews[instance]);
+	data = &(view->data);
+
+	/* clear only the final color status bits - the cached colortable
+		colors remain valid when just the shading parameters change */
+	view->colordonecount = 0;
 	if (data->primary_stat_color != NULL)
 		memset(data->primary_stat_color, 0, (data->primary_nxy / 8) + 1);
 
@@ -3380,202 +3425,219 @@ int mbview_colorpoint(
 		fprintf(stderr,"dbg2       k:                %d\n",k);
 		}
 
-	/* get values for coloring */
-	if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
+	/* get the colortable color unless a valid one is already cached -
+	   changes to the shading parameters alone do not invalidate it */
+	if (!(view->primary_stat_basecolor[k/8] & statmask[k%8]))
 		{
-		value = data->primary_data[k];
-		}
-	else if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
-		{
-		value = sqrt(data->primary_dzdx[k]
-					* data->primary_dzdx[k]
-				+ data->primary_dzdy[k]
-					* data->primary_dzdy[k]);
-		}
-	else if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
-		{
-		if (data->secondary_sameas_primary == MB_YES)
-			value = data->secondary_data[k];
-		else
-			mbview_getsecondaryvalue(view, data, i, j, &value);
-		}
+		/* get values for coloring */
+		if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
+			{
+			value = data->primary_data[k];
+			}
+		else if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
+			{
+			value = sqrt(data->primary_dzdx[k]
+						* data->primary_dzdx[k]
+					+ data->primary_dzdy[k]
+						* data->primary_dzdy[k]);
+			}
+		else if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
+			{
+			if (data->secondary_sameas_primary == MB_YES)
+				value = data->secondary_data[k];
+			else
+				mbview_getsecondaryvalue(view, data, i, j, &value);
+			}
 
-	/* get color */
-	if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE
-		&& view->colortable < MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    mbview_getcolor(value, view->min, view->max, view->colortable_mode,
-	    		(float) 0.0, (float) 0.0, (float) 1.0,
-	    		(float) 1.0, (float) 0.0, (float) 0.0,
-			view->colortable_red,
-			view->colortable_green,
-			view->colortable_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-	    }
-	else if (view->colortable < MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    mbview_getcolor(value, view->min, view->max, view->colortable_mode,
-			view->colortable_red[0],
-			view->colortable_green[0],
-			view->colortable_blue[0],
-			view->colortable_red[MBV_NUM_COLORS-1],
-			view->colortable_green[MBV_NUM_COLORS-1],
-			view->colortable_blue[MBV_NUM_COLORS-1],
-			view->colortable_red,
-			view->colortable_green,
-			view->colortable_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-	    }
-	else if (view->colortable == MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    if (value > 0.0)
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
-		    {
-		    mbview_getcolor(value, 0.0, view->max, view->colortable_mode,
-			colortable_abovesealevel1_red[0],
-			colortable_abovesealevel1_green[0],
-			colortable_abovesealevel1_blue[0],
-			colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_red,
-			colortable_abovesealevel1_green,
-			colortable_abovesealevel1_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		else
-		    {
-		    mbview_getcolor(value, -view->max / 11.0, view->max, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		}
-	    else
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
-		    {
-		    mbview_getcolor(value, view->min, 0.0, view->colortable_mode,
-			colortable_abovesealevel1_red[0],
-			colortable_abovesealevel1_green[0],
-			colortable_abovesealevel1_blue[0],
-			colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_red,
-			colortable_abovesealevel1_green,
-			colortable_abovesealevel1_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		else
-		    {
-		    mbview_getcolor(value, view->min, -view->min / 11.0, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		}
-	    }
-	else if (view->colortable == MBV_COLORTABLE_SEALEVEL2)
-	    {
-	    if (value > 0.0)
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+		/* get color */
+		if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE
+			&& view->colortable < MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor(value, 0.0, view->max, view->colortable_mode,
-			colortable_abovesealevel2_red[0],
-			colortable_abovesealevel2_green[0],
-			colortable_abovesealevel2_blue[0],
-			colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_red,
-			colortable_abovesealevel2_green,
-			colortable_abovesealevel2_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    mbview_getcolor(value, view->min, view->max, view->colortable_mode,
+		    		(float) 0.0, (float) 0.0, (float) 1.0,
+		    		(float) 1.0, (float) 0.0, (float) 0.0,
+				view->colortable_red,
+				view->colortable_green,
+				view->colortable_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
 		    }
-		else
+		else if (view->colortable < MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor(value, -view->max / 11.0, view->max, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    mbview_getcolor(value, view->min, view->max, view->colortable_mode,
+				view->colortable_red[0],
+				view->colortable_green[0],
+				view->colortable_blue[0],
+				view->colortable_red[MBV_NUM_COLORS-1],
+				view->colortable_green[MBV_NUM_COLORS-1],
+				view->colortable_blue[MBV_NUM_COLORS-1],
+				view->colortable_red,
+				view->colortable_green,
+				view->colortable_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
 		    }
-		}
-	    else
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+		else if (view->colortable == MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor(value, view->min, 0.0, view->colortable_mode,
-			colortable_abovesealevel2_red[0],
-			colortable_abovesealevel2_green[0],
-			colortable_abovesealevel2_blue[0],
-			colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_red,
-			colortable_abovesealevel2_green,
-			colortable_abovesealevel2_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    if (value > 0.0)
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+			    {
+			    mbview_getcolor(value, 0.0, view->max, view->colortable_mode,
+				colortable_abovesealevel1_red[0],
+				colortable_abovesealevel1_green[0],
+				colortable_abovesealevel1_blue[0],
+				colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_red,
+				colortable_abovesealevel1_green,
+				colortable_abovesealevel1_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor(value, -view->max / 11.0, view->max, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
+		    else
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+			    {
+			    mbview_getcolor(value, view->min, 0.0, view->colortable_mode,
+				colortable_abovesealevel1_red[0],
+				colortable_abovesealevel1_green[0],
+				colortable_abovesealevel1_blue[0],
+				colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_red,
+				colortable_abovesealevel1_green,
+				colortable_abovesealevel1_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor(value, view->min, -view->min / 11.0, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
 		    }
-		else
+		else if (view->colortable == MBV_COLORTABLE_SEALEVEL2)
 		    {
-		    mbview_getcolor(value, view->min, -view->min / 11.0, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    if (value > 0.0)
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+			    {
+			    mbview_getcolor(value, 0.0, view->max, view->colortable_mode,
+				colortable_abovesealevel2_red[0],
+				colortable_abovesealevel2_green[0],
+				colortable_abovesealevel2_blue[0],
+				colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_red,
+				colortable_abovesealevel2_green,
+				colortable_abovesealevel2_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor(value, -view->max / 11.0, view->max, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
+		    else
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+			    {
+			    mbview_getcolor(value, view->min, 0.0, view->colortable_mode,
+				colortable_abovesealevel2_red[0],
+				colortable_abovesealevel2_green[0],
+				colortable_abovesealevel2_blue[0],
+				colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_red,
+				colortable_abovesealevel2_green,
+				colortable_abovesealevel2_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor(value, view->min, -view->min / 11.0, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
 		    }
+
+		/* save the colortable color */
+		view->primary_basecolor[3*k] = data->primary_r[k];
+		view->primary_basecolor[3*k+1] = data->primary_g[k];
+		view->primary_basecolor[3*k+2] = data->primary_b[k];
+		view->primary_stat_basecolor[k/8]
+			= view->primary_stat_basecolor[k/8] | statmask[k%8];
 		}
-	    }
+
+	/* start shading from the cached colortable color */
+	data->primary_r[k] = view->primary_basecolor[3*k];
+	data->primary_g[k] = view->primary_basecolor[3*k+1];
+	data->primary_b[k] = view->primary_basecolor[3*k+2];
 
 	/* get values for shading */
 	if (view->shade_mode != MBV_SHADE_VIEW_NONE)
@@ -3680,212 +3742,229 @@ int mbview_colorpoint_histogram(
 		fprintf(stderr,"dbg2       k:                %d\n",k);
 		}
 
-	/* get values for coloring */
-	if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
+	/* get the colortable color unless a valid one is already cached -
+	   changes to the shading parameters alone do not invalidate it */
+	if (!(view->primary_stat_basecolor[k/8] & statmask[k%8]))
 		{
-		value = data->primary_data[k];
-		}
-	else if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
-		{
-		value = sqrt(data->primary_dzdx[k]
-					* data->primary_dzdx[k]
-				+ data->primary_dzdy[k]
-					* data->primary_dzdy[k]);
-		}
-	else if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
-		{
-		if (data->secondary_sameas_primary == MB_YES)
-			value = data->secondary_data[k];
-		else
-			mbview_getsecondaryvalue(view, data, i, j, &value);
-		}
+		/* get values for coloring */
+		if (data->grid_mode == MBV_GRID_VIEW_PRIMARY)
+			{
+			value = data->primary_data[k];
+			}
+		else if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE)
+			{
+			value = sqrt(data->primary_dzdx[k]
+						* data->primary_dzdx[k]
+					+ data->primary_dzdy[k]
+						* data->primary_dzdy[k]);
+			}
+		else if (data->grid_mode == MBV_GRID_VIEW_SECONDARY)
+			{
+			if (data->secondary_sameas_primary == MB_YES)
+				value = data->secondary_data[k];
+			else
+				mbview_getsecondaryvalue(view, data, i, j, &value);
+			}
 
-	/* get color */
-	if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE
-		&& view->colortable < MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    mbview_getcolor_histogram(value, view->min, view->max, view->colortable_mode,
-	    		(float) 0.0, (float) 0.0, (float) 1.0,
-	    		(float) 1.0, (float) 0.0, (float) 0.0,
-			view->colortable_red,
-			view->colortable_green,
-			view->colortable_blue,
-			histogram,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-	    }
-	else if (view->colortable < MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    mbview_getcolor_histogram(value, view->min, view->max, view->colortable_mode,
-			view->colortable_red[0],
-			view->colortable_green[0],
-			view->colortable_blue[0],
-			view->colortable_red[MBV_NUM_COLORS-1],
-			view->colortable_green[MBV_NUM_COLORS-1],
-			view->colortable_blue[MBV_NUM_COLORS-1],
-			view->colortable_red,
-			view->colortable_green,
-			view->colortable_blue,
-			histogram,
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-	    }
-	else if (view->colortable == MBV_COLORTABLE_SEALEVEL1)
-	    {
-	    if (value > 0.0)
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
-		    {
-		    mbview_getcolor_histogram(value, 0.0, view->max, view->colortable_mode,
-			colortable_abovesealevel1_red[0],
-			colortable_abovesealevel1_green[0],
-			colortable_abovesealevel1_blue[0],
-			colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_red,
-			colortable_abovesealevel1_green,
-			colortable_abovesealevel1_blue,
-			&(histogram[2*MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		else
-		    {
-		    mbview_getcolor_histogram(value, -view->max / 11.0, view->max, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&(histogram[2*MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		}
-	    else
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
-		    {
-		    mbview_getcolor_histogram(value, view->min, 0.0, view->colortable_mode,
-			colortable_abovesealevel1_red[0],
-			colortable_abovesealevel1_green[0],
-			colortable_abovesealevel1_blue[0],
-			colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel1_red,
-			colortable_abovesealevel1_green,
-			colortable_abovesealevel1_blue,
-			&(histogram[MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		else
-		    {
-		    mbview_getcolor_histogram(value, view->min, -view->min / 11.0, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&(histogram[MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
-		    }
-		}
-	    }
-	else if (view->colortable == MBV_COLORTABLE_SEALEVEL2)
-	    {
-	    if (value > 0.0)
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+		/* get color */
+		if (data->grid_mode == MBV_GRID_VIEW_PRIMARYSLOPE
+			&& view->colortable < MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor_histogram(value, 0.0, view->max, view->colortable_mode,
-			colortable_abovesealevel2_red[0],
-			colortable_abovesealevel2_green[0],
-			colortable_abovesealevel2_blue[0],
-			colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_red,
-			colortable_abovesealevel2_green,
-			colortable_abovesealevel2_blue,
-			&(histogram[2*MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    mbview_getcolor_histogram(value, view->min, view->max, view->colortable_mode,
+		    		(float) 0.0, (float) 0.0, (float) 1.0,
+		    		(float) 1.0, (float) 0.0, (float) 0.0,
+				view->colortable_red,
+				view->colortable_green,
+				view->colortable_blue,
+				histogram,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
 		    }
-		else
+		else if (view->colortable < MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor_histogram(value, -view->max / 11.0, view->max, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&(histogram[2*MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    mbview_getcolor_histogram(value, view->min, view->max, view->colortable_mode,
+				view->colortable_red[0],
+				view->colortable_green[0],
+				view->colortable_blue[0],
+				view->colortable_red[MBV_NUM_COLORS-1],
+				view->colortable_green[MBV_NUM_COLORS-1],
+				view->colortable_blue[MBV_NUM_COLORS-1],
+				view->colortable_red,
+				view->colortable_green,
+				view->colortable_blue,
+				histogram,
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
 		    }
-		}
-	    else
-		{
-		if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+		else if (view->colortable == MBV_COLORTABLE_SEALEVEL1)
 		    {
-		    mbview_getcolor_histogram(value, view->min, 0.0, view->colortable_mode,
-			colortable_abovesealevel2_red[0],
-			colortable_abovesealevel2_green[0],
-			colortable_abovesealevel2_blue[0],
-			colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
-			colortable_abovesealevel2_red,
-			colortable_abovesealevel2_green,
-			colortable_abovesealevel2_blue,
-			&(histogram[MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    if (value > 0.0)
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+			    {
+			    mbview_getcolor_histogram(value, 0.0, view->max, view->colortable_mode,
+				colortable_abovesealevel1_red[0],
+				colortable_abovesealevel1_green[0],
+				colortable_abovesealevel1_blue[0],
+				colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_red,
+				colortable_abovesealevel1_green,
+				colortable_abovesealevel1_blue,
+				&(histogram[2*MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor_histogram(value, -view->max / 11.0, view->max, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&(histogram[2*MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
+		    else
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+			    {
+			    mbview_getcolor_histogram(value, view->min, 0.0, view->colortable_mode,
+				colortable_abovesealevel1_red[0],
+				colortable_abovesealevel1_green[0],
+				colortable_abovesealevel1_blue[0],
+				colortable_abovesealevel1_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel1_red,
+				colortable_abovesealevel1_green,
+				colortable_abovesealevel1_blue,
+				&(histogram[MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor_histogram(value, view->min, -view->min / 11.0, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&(histogram[MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
 		    }
-		else
+		else if (view->colortable == MBV_COLORTABLE_SEALEVEL2)
 		    {
-		    mbview_getcolor_histogram(value, view->min, -view->min / 11.0, view->colortable_mode,
-			colortable_haxby_red[0],
-			colortable_haxby_green[0],
-			colortable_haxby_blue[0],
-			colortable_haxby_red[MBV_NUM_COLORS-1],
-			colortable_haxby_green[MBV_NUM_COLORS-1],
-			colortable_haxby_blue[MBV_NUM_COLORS-1],
-			colortable_haxby_red,
-			colortable_haxby_green,
-			colortable_haxby_blue,
-			&(histogram[MBV_NUM_COLORS]),
-			&data->primary_r[k],
-			&data->primary_g[k],
-			&data->primary_b[k]);
+		    if (value > 0.0)
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_NORMAL)
+			    {
+			    mbview_getcolor_histogram(value, 0.0, view->max, view->colortable_mode,
+				colortable_abovesealevel2_red[0],
+				colortable_abovesealevel2_green[0],
+				colortable_abovesealevel2_blue[0],
+				colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_red,
+				colortable_abovesealevel2_green,
+				colortable_abovesealevel2_blue,
+				&(histogram[2*MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor_histogram(value, -view->max / 11.0, view->max, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&(histogram[2*MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
+		    else
+			{
+			if (view->colortable_mode == MBV_COLORTABLE_REVERSED)
+			    {
+			    mbview_getcolor_histogram(value, view->min, 0.0, view->colortable_mode,
+				colortable_abovesealevel2_red[0],
+				colortable_abovesealevel2_green[0],
+				colortable_abovesealevel2_blue[0],
+				colortable_abovesealevel2_red[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_green[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_blue[MBV_NUM_COLORS-1],
+				colortable_abovesealevel2_red,
+				colortable_abovesealevel2_green,
+				colortable_abovesealevel2_blue,
+				&(histogram[MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			else
+			    {
+			    mbview_getcolor_histogram(value, view->min, -view->min / 11.0, view->colortable_mode,
+				colortable_haxby_red[0],
+				colortable_haxby_green[0],
+				colortable_haxby_blue[0],
+				colortable_haxby_red[MBV_NUM_COLORS-1],
+				colortable_haxby_green[MBV_NUM_COLORS-1],
+				colortable_haxby_blue[MBV_NUM_COLORS-1],
+				colortable_haxby_red,
+				colortable_haxby_green,
+				colortable_haxby_blue,
+				&(histogram[MBV_NUM_COLORS]),
+				&data->primary_r[k],
+				&data->primary_g[k],
+				&data->primary_b[k]);
+			    }
+			}
 		    }
+
+		/* save the colortable color */
+		view->primary_basecolor[3*k] = data->primary_r[k];
+		view->primary_basecolor[3*k+1] = data->primary_g[k];
+		view->primary_basecolor[3*k+2] = data->primary_b[k];
+		view->primary_stat_basecolor[k/8]
+			= view->primary_stat_basecolor[k/8] | statmask[k%8];
 		}
-	    }
+
+	/* start shading from the cached colortable color */
+	data->primary_r[k] = view->primary_basecolor[3*k];
+	data->primary_g[k] = view->primary_basecolor[3*k+1];
+	data->primary_b[k] = view->primary_basecolor[3*k+2];
 
 	/* get values for shading */
 	if (view->shade_mode != MBV_SHADE_VIEW_NONE)
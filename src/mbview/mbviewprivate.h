@@ -221,6 +221,8 @@ struct mbview_world_struct
     float *colortable_green;
     int	shade_mode;
     double sign;
+    float *primary_basecolor;
+    char *primary_stat_basecolor;
     int	primary_histogram_set;
     int	primaryslope_histogram_set;
     int	secondary_histogram_set;
@@ -755,6 +757,7 @@ int mbview_greatcircle_endposition(size_t instance,
 			double lon1, double lat1, double bearing, double distance,
 			double *lon2, double *lat2);
 int mbview_colorclear(size_t instance);
+int mbview_shadeclear(size_t instance);
 int mbview_zscaleclear(size_t instance);
 int mbview_setcolorparms(size_t instance);
 int mbview_make_histogram(
@@ -40,6 +40,12 @@
  * according to -Dinterval. MBotps also sets the parameter file for each
  * swath file so that mbprocess applies the tide model during processing.
  *
+ * Tides are predicted directly from the harmonic constants of OTPS
+ * binary tide models, which are memory mapped so only the parts of
+ * the model grids that are used get read. Models in other forms
+ * (e.g. the netCDF OTPSnc models) are handled by running the OTPS
+ * program predict_tide.
+ *
  * Author:	D. W. Caress
  * Date:	July 30,  2009
  *
@@ -54,7 +60,10 @@
 #include <math.h>
 #include <string.h>
 #include <time.h>
+#include <ctype.h>
+#include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 
 /* MBIO include files */
 #include "mb_status.h"
@@ -68,17 +77,138 @@
 /* local defines */
 #define MBOTPS_MODE_POSITION	0
 #define MBOTPS_MODE_NAVIGATION 	1
+#define MBOTPS_ALLOC_NUM	1024
+#define MBOTPS_NCONSTITUENT_MAX	64
+#define MBOTPS_MJD_EPOCH	40587.0		/* modified julian day of 1970/01/01 */
+#define MBOTPS_TIME_REF		694224000.0	/* OTPS reference time 1992/01/01 */
+
+/* nodal correction types */
+#define MBOTPS_NODAL_NONE	0
+#define MBOTPS_NODAL_O1		1
+#define MBOTPS_NODAL_K1		2
+#define MBOTPS_NODAL_M2		3
+#define MBOTPS_NODAL_K2		4
+#define MBOTPS_NODAL_J1		5
+#define MBOTPS_NODAL_OO1	6
+#define MBOTPS_NODAL_MF		7
+#define MBOTPS_NODAL_MM		8
+#define MBOTPS_NODAL_L2		9
+#define MBOTPS_NODAL_M1		10
+#define MBOTPS_NODAL_M4		11
+#define MBOTPS_NODAL_M6		12
+#define MBOTPS_NODAL_M8		13
+#define MBOTPS_NODAL_MK3	14
+#define MBOTPS_NODAL_2SM2	15
+#define MBOTPS_NODAL_2MK3	16
+
+/* tidal constituents known to OTPS: frequencies (radians/second),
+	astronomical arguments at the OTPS reference time (radians),
+	and nodal correction types */
+#define MBOTPS_NCONSTITUENT_TABLE	29
+static char *mbotps_constituent_name[MBOTPS_NCONSTITUENT_TABLE] =
+	{ "m2", "s2", "k1", "o1", "n2", "p1", "k2", "q1",
+	  "2n2", "mu2", "nu2", "l2", "t2", "j1", "m1", "oo1",
+	  "rho1", "mf", "mm", "ssa", "m4", "ms4", "mn4", "m6",
+	  "m8", "mk3", "s6", "2sm2", "2mk3" };
+static double mbotps_constituent_omega[MBOTPS_NCONSTITUENT_TABLE] =
+	{ 1.405189e-04, 1.454441e-04, 7.292117e-05, 6.759774e-05,
+	  1.378797e-04, 7.252295e-05, 1.458423e-04, 6.495854e-05,
+	  1.352405e-04, 1.355937e-04, 1.382329e-04, 1.431581e-04,
+	  1.452450e-04, 7.556036e-05, 7.028195e-05, 7.824458e-05,
+	  6.531174e-05, 5.323414e-06, 2.639203e-06, 3.982128e-07,
+	  2.810377e-04, 2.859630e-04, 2.783984e-04, 4.215566e-04,
+	  5.620755e-04, 2.134402e-04, 4.363323e-04, 1.503693e-04,
+	  2.081166e-04 };
+static double mbotps_constituent_phase[MBOTPS_NCONSTITUENT_TABLE] =
+	{ 1.731557546, 0.000000000, 0.173003674, 1.558553872,
+	  6.050721243, 6.110181633, 3.487600001, 5.877717569,
+	  4.086699633, 3.463115091, 5.427136701, 0.553986502,
+	  0.052841931, 2.137025284, 2.436575100, 1.929046130,
+	  5.254133027, 1.756042456, 1.964021610, 3.487600001,
+	  3.463115091, 1.731557546, 1.499093481, 5.194672637,
+	  6.926230184, 1.904561220, 0.000000000, 4.551627762,
+	  3.290111417 };
+static int mbotps_constituent_nodal[MBOTPS_NCONSTITUENT_TABLE] =
+	{ MBOTPS_NODAL_M2, MBOTPS_NODAL_NONE, MBOTPS_NODAL_K1, MBOTPS_NODAL_O1,
+	  MBOTPS_NODAL_M2, MBOTPS_NODAL_NONE, MBOTPS_NODAL_K2, MBOTPS_NODAL_O1,
+	  MBOTPS_NODAL_M2, MBOTPS_NODAL_M2, MBOTPS_NODAL_M2, MBOTPS_NODAL_L2,
+	  MBOTPS_NODAL_NONE, MBOTPS_NODAL_J1, MBOTPS_NODAL_M1, MBOTPS_NODAL_OO1,
+	  MBOTPS_NODAL_O1, MBOTPS_NODAL_MF, MBOTPS_NODAL_MM, MBOTPS_NODAL_NONE,
+	  MBOTPS_NODAL_M4, MBOTPS_NODAL_M2, MBOTPS_NODAL_M4, MBOTPS_NODAL_M6,
+	  MBOTPS_NODAL_M8, MBOTPS_NODAL_MK3, MBOTPS_NODAL_NONE, MBOTPS_NODAL_2SM2,
+	  MBOTPS_NODAL_2MK3 };
+
+/* OTPS binary tide model */
+struct mbotps_model_struct
+	{
+	mb_path	elevfile;
+	mb_path	gridfile;
+	int	swapped;
+	int	n;
+	int	m;
+	int	nc;
+	double	lon_min;
+	double	lon_max;
+	double	lat_min;
+	double	lat_max;
+	double	dlon;
+	double	dlat;
+	int	global;
+	char	constituent[MBOTPS_NCONSTITUENT_MAX][5];
+	int	index[MBOTPS_NCONSTITUENT_MAX];
+
+	/* mapped elevation file and ocean mask */
+	char	*map;
+	size_t	mapsize;
+	size_t	offset[MBOTPS_NCONSTITUENT_MAX];
+	int	*mask;
+
+	/* harmonic constants of the last location */
+	int	cache_ok;
+	int	cache_status;
+	int	cache_error;
+	double	cache_lon;
+	double	cache_lat;
+	double	hc_re[MBOTPS_NCONSTITUENT_MAX];
+	double	hc_im[MBOTPS_NCONSTITUENT_MAX];
+
+	/* nodal corrections of the last day */
+	double	nodal_day;
+	double	pf[MBOTPS_NCONSTITUENT_MAX];
+	double	pu[MBOTPS_NCONSTITUENT_MAX];
+	};
+
+/* local function prototypes */
+int mbotps_read_record(int verbose, FILE *fp, int swapped,
+		char **buffer, int *buffer_alloc, int *length, int *error);
+int mbotps_model_open(int verbose, char *otps_location, char *otps_model,
+		struct mbotps_model_struct *model, int *error);
+int mbotps_model_close(int verbose, struct mbotps_model_struct *model, int *error);
+int mbotps_model_interp(int verbose, struct mbotps_model_struct *model,
+		double lon, double lat, int *error);
+int mbotps_model_nodal(int verbose, struct mbotps_model_struct *model,
+		double mjd, int *error);
+int mbotps_model_predict(int verbose, struct mbotps_model_struct *model,
+		int npoint, double *lon, double *lat, double *time_d,
+		double *tide, int *ngood, int *error);
+int mbotps_predict_external(int verbose, char *otps_location, char *otps_model,
+		int npoint, double *lon, double *lat, double *time_d,
+		double *tide, int *ngood, int *error);
+int mbotps_write_tidefile(int verbose, char *tidefile, char *otps_model,
+		int builtin, int tideformat,
+		int ntide, double *time_d, double *tide, int *error);
 
 /* system function declarations */
 char	*ctime();
 char	*getenv();
 
+static char rcs_id[] = "$Id$";
+static char program_name[] = "mbotps";
+
 /*--------------------------------------------------------------------*/
 
 int main (int argc, char **argv)
 {
-	static char rcs_id[] = "$Id$";
-	static char program_name[] = "mbotps";
 	static char help_message[] =  "MBotps predicts tides using methods and data derived from the OSU Tidal Prediction Software (OTPS) distributions.";
 	static char usage_message[] = "mbotps [-Atideformat -Byear/month/day/hour/minute/second -Dinterval\n\t-Eyear/month/day/hour/minute/second -Fformat\n"
 					"\t-Idatalist.mb-1 -Lopts_path -Ooutput -Potps_location -Rlon/lat -Tmodel -V]";
@@ -152,18 +282,20 @@ int main (int argc, char **argv)
 	int	tideformat = 2;
 	int	ngood;
 
-	/* time parameters */
-	time_t	right_now;
-	char	date[32], user[MB_PATH_MAXLINE], *user_ptr, host[MB_PATH_MAXLINE];
-	int	pid;
-
-	FILE	*tfp, *mfp, *ofp;
+	/* tide prediction points */
+	struct mbotps_model_struct model;
+	int	otps_builtin = MB_NO;
+	int	npoint = 0;
+	int	npoint_alloc = 0;
+	double	*plon = NULL;
+	double	*plat = NULL;
+	double	*ptime_d = NULL;
+	double	*ptide = NULL;
+
+	FILE	*tfp, *mfp;
 	struct stat file_status;
 	int	fstat;
-	mb_path	lltfile;
-	mb_path	otpsfile;
 	mb_path	line;
-	mb_path	predict_tide;
 	int	otps_model_set = MB_NO;
 	mb_path	otps_model;
 	mb_path	modelname;
@@ -172,18 +304,11 @@ int main (int argc, char **argv)
 	int	read_data;
 	int	ntime;
 	int	nread;
-	int	nline;
-	int	nget;
 	int	output;
 	double	savetime_d;
 	double	lasttime_d;
 	double	lastlon;
 	double	lastlat;
-	double	lon;
-	double	lat;
-	double	tide;
-	double	depth;
-	char	*result;
 	int	i;
 
 	/* get current default values */
@@ -434,150 +559,76 @@ int main (int argc, char **argv)
 		exit(error);
 		}
 
+	/* use the built in tidal prediction if the model is an OTPS
+		binary model, otherwise fall back to calling predict_tide */
+	if ((status = mbotps_model_open(verbose, otps_location_use, otps_model,
+					&model, &error)) == MB_SUCCESS)
+		{
+		otps_builtin = MB_YES;
+		if (verbose > 0)
+			fprintf(stderr,"Predicting tides from OTPS model %s directly\n", otps_model);
+		}
+	else
+		{
+		otps_builtin = MB_NO;
+		status = MB_SUCCESS;
+		error = MB_ERROR_NO_ERROR;
+		if (verbose > 0)
+			fprintf(stderr,"Predicting tides from OTPS model %s using predict_tide\n", otps_model);
+		}
+
 	/* get tides for a single position and time range */
 	if (mbotps_mode == MBOTPS_MODE_POSITION)
 		{
-		/* first open temporary file of lat lon time */
-		pid = getpid();
-		sprintf(lltfile, "tmp_mbotps_llt_%d.txt", pid);
-		sprintf(otpsfile, "tmp_mbotps_llttd_%d.txt", pid);
-		if ((tfp = fopen(lltfile,"w")) == NULL)
-			{
-			error = MB_ERROR_OPEN_FAIL;
-			fprintf(stderr,"\nUnable to open temporary lat-lon-time file <%s> for writing\n",lltfile);
-			fprintf(stderr,"\nProgram <%s> Terminated\n",
-				program_name);
-			exit(MB_FAILURE);
-			}
-
-		/* make sure longitude is positive */
-		if (tidelon < 0.0)
-			tidelon += 360.0;
-
-		/* loop over the time of interest generating the lat-lon-time values */
+		/* allocate the lat lon time arrays */
 		mb_get_time(verbose, btime_i, &btime_d);
 		mb_get_time(verbose, etime_i, &etime_d);
 		ntime = 1 + (int)floor((etime_d - btime_d) / interval);
-		for (i=0;i<ntime;i++)
-			{
-			time_d = btime_d + i * interval;
-			mb_get_date(verbose, time_d, time_i);
-			fprintf(tfp, "%.6f %.6f %4.4d %2.2d %2.2d %2.2d %2.2d %2.2d\n",
-				tidelat, tidelon, time_i[0], time_i[1], time_i[2], time_i[3], time_i[4], time_i[5]);
-			}
-
-		/* close the llt file */
-		fclose(tfp);
-
-		/* call predict_tide with popen */
-		sprintf(predict_tide, "%s/predict_tide", otps_location_use);
-		if ((tfp = popen(predict_tide, "w")) == NULL)
+		npoint_alloc = MAX(ntime, 1);
+		status = mb_mallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&plon, &error);
+		if (status == MB_SUCCESS)
+			status = mb_mallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&plat, &error);
+		if (status == MB_SUCCESS)
+			status = mb_mallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&ptime_d, &error);
+		if (status == MB_SUCCESS)
+			status = mb_mallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&ptide, &error);
+		if (error != MB_ERROR_NO_ERROR)
 			{
-			error = MB_ERROR_OPEN_FAIL;
-			fprintf(stderr,"\nUnable to open predict_time program using popen()\n");
+			mb_error(verbose,error,&message);
+			fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",
+				message);
 			fprintf(stderr,"\nProgram <%s> Terminated\n",
 				program_name);
-			exit(MB_FAILURE);
+			exit(error);
 			}
 
-		/* send relevant input to predict_tide through its stdin stream */
-		fprintf(tfp, "%s/DATA/Model_%s\n", otps_location_use,otps_model);
-		fprintf(tfp, "%s\n", lltfile);
-		fprintf(tfp, "z\n\nAP\noce\n1\n");
-		/*fprintf(tfp, "z\nm2,s2,n2,k2,k1,o1,p1,q1\nAP\noce\n1\n");*/
-		fprintf(tfp, "%s\n", otpsfile);
-
-		/* close the process */
-		pclose(tfp);
-
-		/* now read results from predict_tide and rewrite them in a useful form */
-		if ((tfp = fopen(otpsfile, "r")) == NULL)
+		/* loop over the time of interest generating the lat-lon-time values */
+		for (i=0;i<ntime;i++)
 			{
-			error = MB_ERROR_OPEN_FAIL;
-			fprintf(stderr,"\nUnable to open predict_time results temporary file <%s>\n", otpsfile);
-			fprintf(stderr,"\nProgram <%s> Terminated\n",
-				program_name);
-			exit(MB_FAILURE);
+			plon[i] = tidelon;
+			plat[i] = tidelat;
+			ptime_d[i] = btime_d + i * interval;
 			}
-		if ((ofp = fopen(tidefile, "w")) == NULL)
+		npoint = ntime;
+
+		/* predict the tides */
+		if (otps_builtin == MB_YES)
+			status = mbotps_model_predict(verbose, &model, npoint, plon, plat,
+						ptime_d, ptide, &ngood, &error);
+		else
+			status = mbotps_predict_external(verbose, otps_location_use, otps_model,
+						npoint, plon, plat, ptime_d, ptide, &ngood, &error);
+
+		/* write the tide file */
+		if (status == MB_SUCCESS)
+			status = mbotps_write_tidefile(verbose, tidefile, otps_model, otps_builtin,
+						tideformat, ngood, ptime_d, ptide, &error);
+		if (status == MB_FAILURE)
 			{
-			error = MB_ERROR_OPEN_FAIL;
-			fprintf(stderr,"\nUnable to open tide output file <%s>\n", tidefile);
 			fprintf(stderr,"\nProgram <%s> Terminated\n",
 				program_name);
 			exit(MB_FAILURE);
 			}
-		fprintf(ofp, "# Tide model generated by program %s\n", program_name);
-		fprintf(ofp, "# Version: %s\n", rcs_id);
-		fprintf(ofp, "# MB-System Version: %s\n", MB_VERSION);
-		fprintf(ofp, "# Tide model generated by program %s\n", program_name);
-		fprintf(ofp, "# which in turn calls OTPS program predict_tide obtained from:\n");
-		fprintf(ofp, "#     http://www.coas.oregonstate.edu/research/po/research/tide/\n");
-		fprintf(ofp, "#\n");
-		fprintf(ofp, "# OTPSnc tide model: \n");
-		fprintf(ofp, "#      %s\n",otps_model);
-		if (tideformat == 2)
-			{
-			fprintf(ofp, "# Output format:\n");
-			fprintf(ofp, "#      year month day hour minute second tide\n");
-			fprintf(ofp, "# where tide is in meters\n");
-			}
-		else
-			{
-			fprintf(ofp, "# Output format:\n");
-			fprintf(ofp, "#      time_d tide\n");
-			fprintf(ofp, "# where time_d is in seconds since January 1, 1970\n");
-			fprintf(ofp, "# and tide is in meters\n");
-			}
-		right_now = time((time_t *)0);
-		strcpy(date,ctime(&right_now));
-                date[strlen(date)-1] = '\0';
-		if ((user_ptr = getenv("USER")) == NULL)
-			user_ptr = getenv("LOGNAME");
-		if (user_ptr != NULL)
-			strcpy(user,user_ptr);
-		else
-			strcpy(user, "unknown");
-		gethostname(host,MBP_FILENAMESIZE);
-		fprintf(ofp,"# Run by user <%s> on cpu <%s> at <%s>\n", user,host,date);
-
-		nline = 0;
-		ngood = 0;
-		while ((result = fgets(line,MB_PATH_MAXLINE,tfp)) == line)
-			{
-			nline++;
-			if (nline == 2 || nline == 3)
-				{
-				fprintf(ofp, "#%s", line);
-				}
-			else if (nline > 6)
-				{
-				nget = sscanf(line,"%lf %lf %d.%d.%d %d:%d:%d %lf %lf",
-					&lat, &lon, &time_i[1], &time_i[2], &time_i[0],
-					&time_i[3], &time_i[4], &time_i[5], &tide, &depth);
-				if (nget == 10)
-					{
-					ngood++;
-					if (tideformat ==2)
-						{
-						fprintf(ofp, "%4.4d %2.2d %2.2d %2.2d %2.2d %2.2d %9.4f\n",
-							time_i[0], time_i[1],  time_i[2],
-							time_i[3], time_i[4],  time_i[5], tide);
-						}
-					else
-						{
-						mb_get_time(verbose,time_i,&time_d);
-						fprintf(ofp, "%.3f %9.4f\n",time_d, tide);
-						}
-					}
-				}
-			}
-		fclose(tfp);
-		fclose(ofp);
-
-		/* remove the temporary files */
-		unlink("lltfile");
-		unlink("otpsfile");
 
 		/* some helpful output */
 		fprintf(stderr, "\nResults are really in %s\n", tidefile);
@@ -627,20 +678,10 @@ int main (int argc, char **argv)
 			/* some helpful output */
 			fprintf(stderr, "\n---------------------------------------\n\nProcessing tides for %s\n\n", file);
 
-			/* first open temporary file of lat lon time */
-			pid = getpid();
+			/* the lat lon time values are accumulated in memory */
 			strcpy(swath_file, file);
-			sprintf(lltfile, "tmp_mbotps_llt_%d.txt", pid);
-			sprintf(otpsfile, "tmp_mbotps_llttd_%d.txt", pid);
 			sprintf(tidefile, "%s.tde", file);
-			if ((tfp = fopen(lltfile,"w")) == NULL)
-				{
-				error = MB_ERROR_OPEN_FAIL;
-				fprintf(stderr,"\nUnable to open temporary lat-lon-time file <%s> for writing\n",lltfile);
-				fprintf(stderr,"\nProgram <%s> Terminated\n",
-					program_name);
-				exit(MB_FAILURE);
-				}
+			npoint = 0;
 
 			/* read fnv file if possible */
 			mb_get_fnv(verbose, file, &format, &error);
@@ -742,15 +783,33 @@ int main (int argc, char **argv)
 					nread++;
 					}
 
-				/* output position and time if flagged or end of file */
-				if (output == MB_YES || error == MB_ERROR_EOF)
+				/* save position and time if flagged or end of file */
+				if ((output == MB_YES || error == MB_ERROR_EOF) && nread > 0)
 					{
-					if (lastlon < 0.0)
-						lastlon += 360.0;
-					mb_get_date(verbose, lasttime_d, time_i);
-					fprintf(tfp, "%.6f %.6f %4.4d %2.2d %2.2d %2.2d %2.2d %2.2d\n",
-							lastlat, lastlon, time_i[0], time_i[1], time_i[2],
-							time_i[3], time_i[4], time_i[5]);
+					if (npoint >= npoint_alloc)
+						{
+						npoint_alloc += MBOTPS_ALLOC_NUM;
+						status = mb_reallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&plon, &error);
+						if (status == MB_SUCCESS)
+							status = mb_reallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&plat, &error);
+						if (status == MB_SUCCESS)
+							status = mb_reallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&ptime_d, &error);
+						if (status == MB_SUCCESS)
+							status = mb_reallocd(verbose, __FILE__, __LINE__, npoint_alloc * sizeof(double), (void **)&ptide, &error);
+						if (status == MB_FAILURE)
+							{
+							mb_error(verbose,error,&message);
+							fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",
+								message);
+							fprintf(stderr,"\nProgram <%s> Terminated\n",
+								program_name);
+							exit(error);
+							}
+						}
+					plon[npoint] = lastlon;
+					plat[npoint] = lastlat;
+					ptime_d[npoint] = lasttime_d;
+					npoint++;
 					}
 				}
 
@@ -760,102 +819,24 @@ int main (int argc, char **argv)
 			/* output read statistics */
 			fprintf(stderr,"%d records read from %s\n", nread, file);
 
-			/* close the llt file */
-			fclose(tfp);
-
-			/* call predict_tide with popen */
-			sprintf(predict_tide, "%s/predict_tide", otps_location_use);
-			if ((tfp = popen(predict_tide, "w")) == NULL)
-				{
-				error = MB_ERROR_OPEN_FAIL;
-				fprintf(stderr,"\nUnable to open predict_time program using popen()\n");
-				fprintf(stderr,"\nProgram <%s> Terminated\n",
-					program_name);
-				exit(MB_FAILURE);
-				}
-
-			/* send relevant input to predict_tide through its stdin stream */
-			fprintf(tfp, "%s/DATA/Model_%s\n", otps_location_use,otps_model);
-			fprintf(tfp, "%s\n", lltfile);
-			fprintf(tfp, "z\n\nAP\noce\n1\n");
-			/*fprintf(tfp, "z\nm2,s2,n2,k2,k1,o1,p1,q1\nAP\noce\n1\n");*/
-			fprintf(tfp, "%s\n", otpsfile);
-
-			/* close the process */
-			pclose(tfp);
-
-			/* now read results from predict_tide and rewrite them in a useful form */
-			if ((tfp = fopen(otpsfile, "r")) == NULL)
-				{
-				error = MB_ERROR_OPEN_FAIL;
-				fprintf(stderr,"\nUnable to open predict_time results temporary file <%s>\n", otpsfile);
-				fprintf(stderr,"\nProgram <%s> Terminated\n",
-					program_name);
-				exit(MB_FAILURE);
-				}
-			if ((ofp = fopen(tidefile, "w")) == NULL)
+			/* predict the tides */
+			if (otps_builtin == MB_YES)
+				status = mbotps_model_predict(verbose, &model, npoint, plon, plat,
+							ptime_d, ptide, &ngood, &error);
+			else
+				status = mbotps_predict_external(verbose, otps_location_use, otps_model,
+							npoint, plon, plat, ptime_d, ptide, &ngood, &error);
+
+			/* write the tide file */
+			if (status == MB_SUCCESS)
+				status = mbotps_write_tidefile(verbose, tidefile, otps_model, otps_builtin,
+							tideformat, ngood, ptime_d, ptide, &error);
+			if (status == MB_FAILURE)
 				{
-				error = MB_ERROR_OPEN_FAIL;
-				fprintf(stderr,"\nUnable to open tide output file <%s>\n", tidefile);
 				fprintf(stderr,"\nProgram <%s> Terminated\n",
 					program_name);
 				exit(MB_FAILURE);
 				}
-			fprintf(ofp, "# Tide model generated by program %s\n", program_name);
-			fprintf(ofp, "# Version: %s\n", rcs_id);
-			fprintf(ofp, "# MB-System Version: %s\n", MB_VERSION);
-			fprintf(ofp, "# Tide model generated by program %s\n", program_name);
-			fprintf(ofp, "# which in turn calls OTPS program predict_tide obtained from:\n");
-			fprintf(ofp, "#     http://www.coas.oregonstate.edu/research/po/research/tide/\n");
-			right_now = time((time_t *)0);
-			strcpy(date,ctime(&right_now));
-			date[strlen(date)-1] = '\0';
-			if ((user_ptr = getenv("USER")) == NULL)
-				user_ptr = getenv("LOGNAME");
-			if (user_ptr != NULL)
-				strcpy(user,user_ptr);
-			else
-				strcpy(user, "unknown");
-			gethostname(host,MBP_FILENAMESIZE);
-			fprintf(ofp,"# Run by user <%s> on cpu <%s> at <%s>\n", user,host,date);
-
-			nline = 0;
-			ngood = 0;
-			while ((result = fgets(line,MB_PATH_MAXLINE,tfp)) == line)
-				{
-				nline++;
-				if (nline == 2 || nline == 3)
-					{
-					fprintf(ofp, "#%s", line);
-					}
-				else if (nline > 6)
-					{
-					nget = sscanf(line,"%lf %lf %d.%d.%d %d:%d:%d %lf %lf",
-						&lat, &lon, &time_i[1], &time_i[2], &time_i[0],
-						&time_i[3], &time_i[4], &time_i[5], &tide, &depth);
-					if (nget == 10)
-						{
-						ngood++;
-						if (tideformat == 2)
-							{
-							fprintf(ofp, "%4.4d %2.2d %2.2d %2.2d %2.2d %2.2d %9.4f\n",
-								time_i[0], time_i[1],  time_i[2],
-								time_i[3], time_i[4],  time_i[5], tide);
-							}
-						else
-							{
-							mb_get_time(verbose,time_i,&time_d);
-							fprintf(ofp, "%.3f %9.4f\n",time_d, tide);
-							}
-						}
-					}
-				}
-			fclose(tfp);
-			fclose(ofp);
-
-			/* remove the temporary files */
-			unlink(lltfile);
-			unlink(otpsfile);
 
 			/* some helpful output */
 			fprintf(stderr, "\nResults are really in %s\n", tidefile);
@@ -889,6 +870,18 @@ int main (int argc, char **argv)
 			mb_datalist_close(verbose,&datalist,&error);
 		}
 
+	/* deallocate memory */
+	if (otps_builtin == MB_YES)
+		mbotps_model_close(verbose, &model, &error);
+	if (plon != NULL)
+		mb_freed(verbose, __FILE__, __LINE__, (void **)&plon, &error);
+	if (plat != NULL)
+		mb_freed(verbose, __FILE__, __LINE__, (void **)&plat, &error);
+	if (ptime_d != NULL)
+		mb_freed(verbose, __FILE__, __LINE__, (void **)&ptime_d, &error);
+	if (ptide != NULL)
+		mb_freed(verbose, __FILE__, __LINE__, (void **)&ptide, &error);
+
 	/* check memory */
 	if (verbose >= 4)
 		status = mb_memory_list(verbose,&error);
@@ -906,3 +899,1014 @@ int main (int argc, char **argv)
 	exit(error);
 }
 /*--------------------------------------------------------------------*/
+int mbotps_read_record(int verbose, FILE *fp, int swapped,
+		char **buffer, int *buffer_alloc, int *length, int *error)
+{
+	char	*function_name = "mbotps_read_record";
+	int	status = MB_SUCCESS;
+	char	marker[4];
+	int	length2;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:      %d\n",verbose);
+		fprintf(stderr,"dbg2       fp:           %p\n",(void *)fp);
+		fprintf(stderr,"dbg2       swapped:      %d\n",swapped);
+		fprintf(stderr,"dbg2       buffer:       %p\n",(void *)*buffer);
+		fprintf(stderr,"dbg2       buffer_alloc: %d\n",*buffer_alloc);
+		}
+
+	/* read the leading record marker of the Fortran record */
+	*length = 0;
+	if (fread(marker, 1, 4, fp) != 4)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_EOF;
+		}
+	else
+		{
+		mb_get_binary_int(swapped, marker, (void *) length);
+		if (*length < 0)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_BAD_FORMAT;
+			}
+		}
+
+	/* make sure the buffer is large enough */
+	if (status == MB_SUCCESS && *length > *buffer_alloc)
+		{
+		status = mb_reallocd(verbose, __FILE__, __LINE__, *length,
+					(void **)buffer, error);
+		if (status == MB_SUCCESS)
+			*buffer_alloc = *length;
+		else
+			*buffer_alloc = 0;
+		}
+
+	/* read the record and check the trailing record marker */
+	if (status == MB_SUCCESS)
+		{
+		if (fread(*buffer, 1, *length, fp) != *length
+			|| fread(marker, 1, 4, fp) != 4)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_EOF;
+			}
+		else
+			{
+			mb_get_binary_int(swapped, marker, (void *) &length2);
+			if (length2 != *length)
+				{
+				status = MB_FAILURE;
+				*error = MB_ERROR_BAD_FORMAT;
+				}
+			}
+		}
+	if (status == MB_SUCCESS)
+		*error = MB_ERROR_NO_ERROR;
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       buffer:       %p\n",(void *)*buffer);
+		fprintf(stderr,"dbg2       buffer_alloc: %d\n",*buffer_alloc);
+		fprintf(stderr,"dbg2       length:       %d\n",*length);
+		fprintf(stderr,"dbg2       error:        %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:       %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_model_open(int verbose, char *otps_location, char *otps_model,
+		struct mbotps_model_struct *model, int *error)
+{
+	char	*function_name = "mbotps_model_open";
+	int	status = MB_SUCCESS;
+	mb_path	modelfile;
+	mb_path	modeldatafile[3];
+	mb_path	path;
+	FILE	*mfp;
+	FILE	*gfp;
+	int	fd;
+	struct stat file_status;
+	char	*buffer = NULL;
+	int	buffer_alloc = 0;
+	int	length;
+	int	header[4];
+	int	nmodeldatafiles;
+	int	n, m;
+	float	lims[4];
+	size_t	offset;
+	int	nhz;
+	int	i, j, k;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       otps_location: %s\n",otps_location);
+		fprintf(stderr,"dbg2       otps_model:    %s\n",otps_model);
+		fprintf(stderr,"dbg2       model:         %p\n",(void *)model);
+		}
+
+	/* initialize the model structure */
+	memset(model, 0, sizeof(struct mbotps_model_struct));
+	model->map = NULL;
+	model->mask = NULL;
+	model->cache_ok = MB_NO;
+	model->nodal_day = -1.0;
+
+	/* the model control file lists the elevation, transport,
+		and grid files - relative paths are taken relative
+		to the OTPS location if they do not resolve as given */
+	sprintf(modelfile, "%s/DATA/Model_%s", otps_location, otps_model);
+	nmodeldatafiles = 0;
+	if ((mfp = fopen(modelfile, "r")) != NULL)
+		{
+		while (nmodeldatafiles < 3
+			&& fgets(path, MB_PATH_MAXLINE, mfp) != NULL)
+			{
+			if (sscanf(path, "%s", modeldatafile[nmodeldatafiles]) == 1)
+				{
+				if (modeldatafile[nmodeldatafiles][0] != '/'
+					&& stat(modeldatafile[nmodeldatafiles], &file_status) != 0)
+					{
+					sprintf(path, "%s/%s", otps_location, modeldatafile[nmodeldatafiles]);
+					strcpy(modeldatafile[nmodeldatafiles], path);
+					}
+				nmodeldatafiles++;
+				}
+			}
+		fclose(mfp);
+		}
+	if (nmodeldatafiles < 3)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		}
+	else
+		{
+		strcpy(model->elevfile, modeldatafile[0]);
+		strcpy(model->gridfile, modeldatafile[2]);
+		}
+
+	/* map the elevation file - the header record holds the grid
+		dimensions, limits, and constituent names, followed by one
+		record of complex elevations for each constituent */
+	if (status == MB_SUCCESS)
+		{
+		if ((fd = open(model->elevfile, O_RDONLY)) < 0)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_OPEN_FAIL;
+			}
+		else
+			{
+			if (fstat(fd, &file_status) == 0 && file_status.st_size > 16)
+				{
+				model->mapsize = file_status.st_size;
+				model->map = (char *) mmap(NULL, model->mapsize, PROT_READ, MAP_SHARED, fd, 0);
+				if (model->map == (char *) MAP_FAILED)
+					model->map = NULL;
+				}
+			close(fd);
+			if (model->map == NULL)
+				{
+				status = MB_FAILURE;
+				*error = MB_ERROR_OPEN_FAIL;
+				}
+			}
+		}
+
+	/* OTPS binary files are Fortran unformatted records, normally
+		big endian - anything else (e.g. OTPSnc netCDF models) is
+		not handled here */
+	if (status == MB_SUCCESS)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_BAD_FORMAT;
+		for (k=0;k<2 && status == MB_FAILURE;k++)
+			{
+			model->swapped = (k == 0 ? MB_NO : MB_YES);
+			for (i=0;i<4;i++)
+				mb_get_binary_int(model->swapped, &model->map[4*i], (void *) &header[i]);
+			if (header[1] > 0 && header[2] > 0
+				&& header[3] > 0 && header[3] <= MBOTPS_NCONSTITUENT_MAX
+				&& header[0] == 28 + 4 * header[3])
+				{
+				status = MB_SUCCESS;
+				*error = MB_ERROR_NO_ERROR;
+				}
+			}
+		}
+	if (status == MB_SUCCESS)
+		{
+		model->n = header[1];
+		model->m = header[2];
+		model->nc = header[3];
+		for (i=0;i<4;i++)
+			mb_get_binary_float(model->swapped, &model->map[16+4*i], (void *) &lims[i]);
+		model->lat_min = lims[0];
+		model->lat_max = lims[1];
+		model->lon_min = lims[2];
+		model->lon_max = lims[3];
+		model->dlon = (model->lon_max - model->lon_min) / model->n;
+		model->dlat = (model->lat_max - model->lat_min) / model->m;
+		if (fabs(model->lon_max - model->lon_min - 360.0) < 0.5 * model->dlon)
+			model->global = MB_YES;
+		else
+			model->global = MB_NO;
+
+		/* get constituent names and locate their records */
+		offset = 8 + header[0];
+		for (k=0;k<model->nc;k++)
+			{
+			strncpy(model->constituent[k], &model->map[32+4*k], 4);
+			model->constituent[k][4] = '\0';
+			for (i=0;i<4;i++)
+				{
+				if (model->constituent[k][i] == ' ')
+					model->constituent[k][i] = '\0';
+				else
+					model->constituent[k][i] = tolower(model->constituent[k][i]);
+				}
+			model->index[k] = -1;
+			for (j=0;j<MBOTPS_NCONSTITUENT_TABLE;j++)
+				if (strcmp(model->constituent[k], mbotps_constituent_name[j]) == 0)
+					model->index[k] = j;
+			if (model->index[k] < 0)
+				fprintf(stderr,"Unknown tidal constituent <%s> in %s will be ignored\n",
+					model->constituent[k], model->elevfile);
+
+			if (offset + 8 + 8 * ((size_t) model->n) * model->m <= model->mapsize)
+				{
+				mb_get_binary_int(model->swapped, &model->map[offset], (void *) &length);
+				if (length == 8 * model->n * model->m)
+					model->offset[k] = offset + 4;
+				else
+					status = MB_FAILURE;
+				}
+			else
+				status = MB_FAILURE;
+			offset += 8 + 8 * ((size_t) model->n) * model->m;
+			}
+		if (status == MB_FAILURE)
+			*error = MB_ERROR_BAD_FORMAT;
+		}
+
+	/* read the ocean mask from the grid file - the header record
+		is followed by the open boundary, depth, and mask records */
+	if (status == MB_SUCCESS)
+		{
+		if ((gfp = fopen(model->gridfile, "r")) == NULL)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_OPEN_FAIL;
+			}
+		else
+			{
+			status = mbotps_read_record(verbose, gfp, model->swapped,
+						&buffer, &buffer_alloc, &length, error);
+			if (status == MB_SUCCESS && length >= 8)
+				{
+				mb_get_binary_int(model->swapped, &buffer[0], (void *) &n);
+				mb_get_binary_int(model->swapped, &buffer[4], (void *) &m);
+				if (n != model->n || m != model->m)
+					{
+					status = MB_FAILURE;
+					*error = MB_ERROR_BAD_FORMAT;
+					}
+				}
+			nhz = 0;
+			while (status == MB_SUCCESS && model->mask == NULL)
+				{
+				status = mbotps_read_record(verbose, gfp, model->swapped,
+							&buffer, &buffer_alloc, &length, error);
+				if (status == MB_SUCCESS && length == 4 * model->n * model->m)
+					{
+					nhz++;
+					if (nhz == 2)
+						{
+						status = mb_mallocd(verbose, __FILE__, __LINE__,
+								model->n * model->m * sizeof(int),
+								(void **)&model->mask, error);
+						for (i=0;i<model->n*model->m && status == MB_SUCCESS;i++)
+							mb_get_binary_int(model->swapped, &buffer[4*i],
+									(void *) &model->mask[i]);
+						}
+					}
+				}
+			fclose(gfp);
+			if (buffer != NULL)
+				mb_freed(verbose, __FILE__, __LINE__, (void **)&buffer, error);
+			if (status == MB_FAILURE && model->mask == NULL)
+				*error = MB_ERROR_BAD_FORMAT;
+			}
+		}
+
+	/* clean up after failure */
+	if (status == MB_FAILURE)
+		{
+		if (model->map != NULL)
+			munmap(model->map, model->mapsize);
+		model->map = NULL;
+		if (model->mask != NULL)
+			mb_freed(verbose, __FILE__, __LINE__, (void **)&model->mask, &k);
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       elevfile:      %s\n",model->elevfile);
+		fprintf(stderr,"dbg2       gridfile:      %s\n",model->gridfile);
+		fprintf(stderr,"dbg2       swapped:       %d\n",model->swapped);
+		fprintf(stderr,"dbg2       n:             %d\n",model->n);
+		fprintf(stderr,"dbg2       m:             %d\n",model->m);
+		fprintf(stderr,"dbg2       nc:            %d\n",model->nc);
+		fprintf(stderr,"dbg2       lon_min:       %f\n",model->lon_min);
+		fprintf(stderr,"dbg2       lon_max:       %f\n",model->lon_max);
+		fprintf(stderr,"dbg2       lat_min:       %f\n",model->lat_min);
+		fprintf(stderr,"dbg2       lat_max:       %f\n",model->lat_max);
+		for (k=0;k<model->nc;k++)
+			fprintf(stderr,"dbg2       constituent[%2d]: %s %d\n",
+				k,model->constituent[k],model->index[k]);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_model_close(int verbose, struct mbotps_model_struct *model, int *error)
+{
+	char	*function_name = "mbotps_model_close";
+	int	status = MB_SUCCESS;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       model:         %p\n",(void *)model);
+		}
+
+	/* release the mapped elevations and the mask */
+	if (model->map != NULL)
+		munmap(model->map, model->mapsize);
+	model->map = NULL;
+	if (model->mask != NULL)
+		status = mb_freed(verbose, __FILE__, __LINE__, (void **)&model->mask, error);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_model_interp(int verbose, struct mbotps_model_struct *model,
+		double lon, double lat, int *error)
+{
+	char	*function_name = "mbotps_model_interp";
+	int	status = MB_SUCCESS;
+	int	ii[2], jj[2];
+	double	x, y, wx, wy, w, wsum;
+	float	zr, zi;
+	char	*ptr;
+	int	i, j, k, l;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       model:         %p\n",(void *)model);
+		fprintf(stderr,"dbg2       lon:           %f\n",lon);
+		fprintf(stderr,"dbg2       lat:           %f\n",lat);
+		}
+
+	/* positions are usually repeated or nearly so, so the
+		harmonic constants of the last location are kept */
+	if (model->cache_ok == MB_YES
+		&& lon == model->cache_lon && lat == model->cache_lat)
+		{
+		status = model->cache_status;
+		*error = model->cache_error;
+		}
+	else
+		{
+		model->cache_ok = MB_YES;
+		model->cache_lon = lon;
+		model->cache_lat = lat;
+
+		/* get grid cell - the model nodes are cell centered */
+		while (lon < model->lon_min)
+			lon += 360.0;
+		while (lon >= model->lon_min + 360.0)
+			lon -= 360.0;
+		x = (lon - model->lon_min) / model->dlon - 0.5;
+		y = (lat - model->lat_min) / model->dlat - 0.5;
+		if (lat < model->lat_min || lat > model->lat_max
+			|| (model->global == MB_NO && lon > model->lon_max))
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_OUT_BOUNDS;
+			}
+		else
+			{
+			ii[0] = (int) floor(x);
+			wx = x - ii[0];
+			if (model->global == MB_YES)
+				{
+				ii[1] = (ii[0] + 1) % model->n;
+				ii[0] = (ii[0] + model->n) % model->n;
+				}
+			else
+				{
+				/* in the half cell outside the first node
+					the value of that node is used */
+				if (ii[0] < 0)
+					{
+					ii[0] = 0;
+					wx = 0.0;
+					}
+				ii[0] = MIN(ii[0], model->n - 1);
+				ii[1] = MIN(ii[0] + 1, model->n - 1);
+				}
+			jj[0] = (int) floor(y);
+			wy = y - jj[0];
+			if (jj[0] < 0)
+				{
+				jj[0] = 0;
+				wy = 0.0;
+				}
+			jj[0] = MIN(jj[0], model->m - 1);
+			jj[1] = MIN(jj[0] + 1, model->m - 1);
+
+			/* bilinear interpolation using only the ocean nodes */
+			for (k=0;k<model->nc;k++)
+				{
+				model->hc_re[k] = 0.0;
+				model->hc_im[k] = 0.0;
+				}
+			wsum = 0.0;
+			for (l=0;l<4;l++)
+				{
+				i = ii[l%2];
+				j = jj[l/2];
+				w = (l % 2 == 0 ? 1.0 - wx : wx) * (l / 2 == 0 ? 1.0 - wy : wy);
+				if (w > 0.0 && model->mask[j * model->n + i] > 0)
+					{
+					wsum += w;
+					for (k=0;k<model->nc;k++)
+						{
+						ptr = &model->map[model->offset[k]
+							+ 8 * ((size_t) j * model->n + i)];
+						mb_get_binary_float(model->swapped, ptr, (void *) &zr);
+						mb_get_binary_float(model->swapped, ptr + 4, (void *) &zi);
+						model->hc_re[k] += w * zr;
+						model->hc_im[k] += w * zi;
+						}
+					}
+				}
+			if (wsum > 0.0)
+				{
+				for (k=0;k<model->nc;k++)
+					{
+					model->hc_re[k] /= wsum;
+					model->hc_im[k] /= wsum;
+					}
+				*error = MB_ERROR_NO_ERROR;
+				}
+			else
+				{
+				status = MB_FAILURE;
+				*error = MB_ERROR_OUT_BOUNDS;
+				}
+			}
+		model->cache_status = status;
+		model->cache_error = *error;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		for (k=0;k<model->nc;k++)
+			fprintf(stderr,"dbg2       hc[%2d]:        %s %f %f\n",
+				k,model->constituent[k],model->hc_re[k],model->hc_im[k]);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_model_nodal(int verbose, struct mbotps_model_struct *model,
+		double mjd, int *error)
+{
+	char	*function_name = "mbotps_model_nodal";
+	int	status = MB_SUCCESS;
+	double	t, p, node;
+	double	sinn, cosn, sin2n, cos2n, sin3n;
+	double	fm2, um2, fk1, uk1;
+	double	f, u, a, b;
+	int	k;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       model:         %p\n",(void *)model);
+		fprintf(stderr,"dbg2       mjd:           %f\n",mjd);
+		}
+
+	/* lunar perigee and node longitudes (degrees) */
+	t = mjd - 51544.4993;
+	p = DTR * (83.3535 + 0.11140353 * t);
+	node = DTR * (125.0445 - 0.05295377 * t);
+	sinn = sin(node);
+	cosn = cos(node);
+	sin2n = sin(2.0 * node);
+	cos2n = cos(2.0 * node);
+	sin3n = sin(3.0 * node);
+
+	/* nodal factors of the constituents that others derive from */
+	a = 1.0 - 0.03731 * cosn + 0.00052 * cos2n;
+	b = 0.03731 * sinn - 0.00052 * sin2n;
+	fm2 = sqrt(a * a + b * b);
+	um2 = DTR * (-2.1 * sinn);
+	a = 1.0 + 0.1158 * cosn - 0.0029 * cos2n;
+	b = 0.1554 * sinn - 0.0029 * sin2n;
+	fk1 = sqrt(a * a + b * b);
+	uk1 = DTR * (-8.9 * sinn + 0.7 * sin2n);
+
+	/* nodal amplitude factor f and phase correction u
+		for each constituent in the model */
+	for (k=0;k<model->nc;k++)
+		{
+		f = 1.0;
+		u = 0.0;
+		switch (model->index[k] >= 0 ? mbotps_constituent_nodal[model->index[k]] : MBOTPS_NODAL_NONE)
+			{
+			case MBOTPS_NODAL_O1:
+				a = 1.0 + 0.189 * cosn - 0.0058 * cos2n;
+				b = 0.189 * sinn - 0.0058 * sin2n;
+				f = sqrt(a * a + b * b);
+				u = DTR * (10.8 * sinn - 1.3 * sin2n + 0.2 * sin3n);
+				break;
+			case MBOTPS_NODAL_K1:
+				f = fk1;
+				u = uk1;
+				break;
+			case MBOTPS_NODAL_M2:
+				f = fm2;
+				u = um2;
+				break;
+			case MBOTPS_NODAL_K2:
+				a = 1.0 + 0.2852 * cosn + 0.0324 * cos2n;
+				b = 0.3108 * sinn + 0.0324 * sin2n;
+				f = sqrt(a * a + b * b);
+				u = DTR * (-17.7 * sinn + 0.7 * sin2n);
+				break;
+			case MBOTPS_NODAL_J1:
+				a = 1.0 + 0.169 * cosn;
+				b = 0.227 * sinn;
+				f = sqrt(a * a + b * b);
+				u = atan2(-b, a);
+				break;
+			case MBOTPS_NODAL_OO1:
+				a = 1.0 + 0.640 * cosn + 0.134 * cos2n;
+				b = 0.640 * sinn + 0.134 * sin2n;
+				f = sqrt(a * a + b * b);
+				u = atan2(-b, a);
+				break;
+			case MBOTPS_NODAL_MF:
+				f = 1.043 + 0.414 * cosn;
+				u = DTR * (-23.7 * sinn + 2.7 * sin2n - 0.4 * sin3n);
+				break;
+			case MBOTPS_NODAL_MM:
+				f = 1.0 - 0.130 * cosn;
+				break;
+			case MBOTPS_NODAL_L2:
+				a = 1.0 - 0.25 * cos(2.0 * p) - 0.11 * cos(2.0 * p - node) - 0.04 * cosn;
+				b = -0.25 * sin(2.0 * p) - 0.11 * sin(2.0 * p - node) - 0.04 * sinn;
+				f = sqrt(a * a + b * b);
+				u = atan2(b, a);
+				break;
+			case MBOTPS_NODAL_M1:
+				a = 2.0 * cos(p) + 0.4 * cos(p - node);
+				b = sin(p) + 0.2 * sin(p - node);
+				f = sqrt(a * a + b * b);
+				u = atan2(b, a);
+				break;
+			case MBOTPS_NODAL_M4:
+				f = fm2 * fm2;
+				u = 2.0 * um2;
+				break;
+			case MBOTPS_NODAL_M6:
+				f = fm2 * fm2 * fm2;
+				u = 3.0 * um2;
+				break;
+			case MBOTPS_NODAL_M8:
+				f = fm2 * fm2 * fm2 * fm2;
+				u = 4.0 * um2;
+				break;
+			case MBOTPS_NODAL_MK3:
+				f = fm2 * fk1;
+				u = um2 + uk1;
+				break;
+			case MBOTPS_NODAL_2SM2:
+				f = fm2;
+				u = -um2;
+				break;
+			case MBOTPS_NODAL_2MK3:
+				f = fm2 * fm2 * fk1;
+				u = 2.0 * um2 - uk1;
+				break;
+			}
+		model->pf[k] = f;
+		model->pu[k] = u;
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		for (k=0;k<model->nc;k++)
+			fprintf(stderr,"dbg2       pf pu[%2d]:     %s %f %f\n",
+				k,model->constituent[k],model->pf[k],model->pu[k]);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_model_predict(int verbose, struct mbotps_model_struct *model,
+		int npoint, double *lon, double *lat, double *time_d,
+		double *tide, int *ngood, int *error)
+{
+	char	*function_name = "mbotps_model_predict";
+	int	status = MB_SUCCESS;
+	double	mjd, day, t, arg, sum;
+	int	i, j, k;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       model:         %p\n",(void *)model);
+		fprintf(stderr,"dbg2       npoint:        %d\n",npoint);
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  lon:%f lat:%f time_d:%f\n",
+				i, lon[i], lat[i], time_d[i]);
+		}
+
+	/* evaluate the tide at each point, compacting the time and tide
+		arrays to hold only the points that lie within the model ocean */
+	*ngood = 0;
+	for (i=0;i<npoint;i++)
+		{
+		/* nodal corrections change slowly so they are evaluated
+			once per day */
+		mjd = MBOTPS_MJD_EPOCH + time_d[i] / 86400.0;
+		day = floor(mjd);
+		if (day != model->nodal_day)
+			{
+			mbotps_model_nodal(verbose, model, day + 0.5, error);
+			model->nodal_day = day;
+			}
+
+		/* harmonic constants at this location */
+		if (mbotps_model_interp(verbose, model, lon[i], lat[i], error) == MB_SUCCESS)
+			{
+			t = time_d[i] - MBOTPS_TIME_REF;
+			sum = 0.0;
+			for (k=0;k<model->nc;k++)
+				{
+				if ((j = model->index[k]) >= 0)
+					{
+					arg = mbotps_constituent_omega[j] * t
+						+ mbotps_constituent_phase[j] + model->pu[k];
+					sum += model->pf[k] * (model->hc_re[k] * cos(arg)
+								- model->hc_im[k] * sin(arg));
+					}
+				}
+			time_d[*ngood] = time_d[i];
+			tide[*ngood] = sum;
+			(*ngood)++;
+			}
+		}
+	*error = MB_ERROR_NO_ERROR;
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       ngood:         %d\n",*ngood);
+		for (i=0;i<*ngood;i++)
+			fprintf(stderr,"dbg2       tide[%d]:  time_d:%f tide:%f\n",
+				i, time_d[i], tide[i]);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_predict_external(int verbose, char *otps_location, char *otps_model,
+		int npoint, double *lon, double *lat, double *time_d,
+		double *tide, int *ngood, int *error)
+{
+	char	*function_name = "mbotps_predict_external";
+	int	status = MB_SUCCESS;
+	FILE	*tfp;
+	mb_path	lltfile;
+	mb_path	otpsfile;
+	mb_path	predict_tide;
+	mb_path	line;
+	int	pid;
+	int	time_i[7];
+	double	tlon, tlat, ttide, depth;
+	int	nline;
+	int	nget;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       otps_location: %s\n",otps_location);
+		fprintf(stderr,"dbg2       otps_model:    %s\n",otps_model);
+		fprintf(stderr,"dbg2       npoint:        %d\n",npoint);
+		for (i=0;i<npoint;i++)
+			fprintf(stderr,"dbg2       point[%d]:  lon:%f lat:%f time_d:%f\n",
+				i, lon[i], lat[i], time_d[i]);
+		}
+
+	/* first write temporary file of lat lon time */
+	*ngood = 0;
+	pid = getpid();
+	sprintf(lltfile, "tmp_mbotps_llt_%d.txt", pid);
+	sprintf(otpsfile, "tmp_mbotps_llttd_%d.txt", pid);
+	if ((tfp = fopen(lltfile,"w")) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		fprintf(stderr,"\nUnable to open temporary lat-lon-time file <%s> for writing\n",lltfile);
+		}
+	else
+		{
+		for (i=0;i<npoint;i++)
+			{
+			tlon = lon[i];
+			if (tlon < 0.0)
+				tlon += 360.0;
+			mb_get_date(verbose, time_d[i], time_i);
+			fprintf(tfp, "%.6f %.6f %4.4d %2.2d %2.2d %2.2d %2.2d %2.2d\n",
+				lat[i], tlon, time_i[0], time_i[1], time_i[2],
+				time_i[3], time_i[4], time_i[5]);
+			}
+		fclose(tfp);
+		}
+
+	/* call predict_tide with popen */
+	if (status == MB_SUCCESS)
+		{
+		sprintf(predict_tide, "%s/predict_tide", otps_location);
+		if ((tfp = popen(predict_tide, "w")) == NULL)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to open predict_time program using popen()\n");
+			}
+		else
+			{
+			/* send relevant input to predict_tide through its stdin stream */
+			fprintf(tfp, "%s/DATA/Model_%s\n", otps_location, otps_model);
+			fprintf(tfp, "%s\n", lltfile);
+			fprintf(tfp, "z\n\nAP\noce\n1\n");
+			/*fprintf(tfp, "z\nm2,s2,n2,k2,k1,o1,p1,q1\nAP\noce\n1\n");*/
+			fprintf(tfp, "%s\n", otpsfile);
+
+			/* close the process */
+			pclose(tfp);
+			}
+		}
+
+	/* now read results from predict_tide */
+	if (status == MB_SUCCESS)
+		{
+		if ((tfp = fopen(otpsfile, "r")) == NULL)
+			{
+			status = MB_FAILURE;
+			*error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to open predict_time results temporary file <%s>\n", otpsfile);
+			}
+		else
+			{
+			nline = 0;
+			while (fgets(line,MB_PATH_MAXLINE,tfp) == line
+				&& *ngood < npoint)
+				{
+				nline++;
+				if (nline > 6)
+					{
+					nget = sscanf(line,"%lf %lf %d.%d.%d %d:%d:%d %lf %lf",
+						&tlat, &tlon, &time_i[1], &time_i[2], &time_i[0],
+						&time_i[3], &time_i[4], &time_i[5], &ttide, &depth);
+					if (nget == 10)
+						{
+						time_i[6] = 0;
+						mb_get_time(verbose, time_i, &time_d[*ngood]);
+						tide[*ngood] = ttide;
+						(*ngood)++;
+						}
+					}
+				}
+			fclose(tfp);
+			}
+		}
+
+	/* remove the temporary files */
+	unlink(lltfile);
+	unlink(otpsfile);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       ngood:         %d\n",*ngood);
+		for (i=0;i<*ngood;i++)
+			fprintf(stderr,"dbg2       tide[%d]:  time_d:%f tide:%f\n",
+				i, time_d[i], tide[i]);
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int mbotps_write_tidefile(int verbose, char *tidefile, char *otps_model,
+		int builtin, int tideformat,
+		int ntide, double *time_d, double *tide, int *error)
+{
+	char	*function_name = "mbotps_write_tidefile";
+	int	status = MB_SUCCESS;
+	FILE	*ofp;
+	time_t	right_now;
+	char	date[32], user[MB_PATH_MAXLINE], *user_ptr, host[MB_PATH_MAXLINE];
+	int	time_i[7];
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> called\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:       %d\n",verbose);
+		fprintf(stderr,"dbg2       tidefile:      %s\n",tidefile);
+		fprintf(stderr,"dbg2       otps_model:    %s\n",otps_model);
+		fprintf(stderr,"dbg2       builtin:       %d\n",builtin);
+		fprintf(stderr,"dbg2       tideformat:    %d\n",tideformat);
+		fprintf(stderr,"dbg2       ntide:         %d\n",ntide);
+		}
+
+	if ((ofp = fopen(tidefile, "w")) == NULL)
+		{
+		status = MB_FAILURE;
+		*error = MB_ERROR_OPEN_FAIL;
+		fprintf(stderr,"\nUnable to open tide output file <%s>\n", tidefile);
+		}
+	else
+		{
+		fprintf(ofp, "# Tide model generated by program %s\n", program_name);
+		fprintf(ofp, "# Version: %s\n", rcs_id);
+		fprintf(ofp, "# MB-System Version: %s\n", MB_VERSION);
+		if (builtin == MB_YES)
+			{
+			fprintf(ofp, "# using harmonic constants from an OTPS tide model obtained from:\n");
+			}
+		else
+			{
+			fprintf(ofp, "# which in turn calls OTPS program predict_tide obtained from:\n");
+			}
+		fprintf(ofp, "#     http://www.coas.oregonstate.edu/research/po/research/tide/\n");
+		fprintf(ofp, "#\n");
+		fprintf(ofp, "# OTPS tide model: \n");
+		fprintf(ofp, "#      %s\n",otps_model);
+		if (tideformat == 2)
+			{
+			fprintf(ofp, "# Output format:\n");
+			fprintf(ofp, "#      year month day hour minute second tide\n");
+			fprintf(ofp, "# where tide is in meters\n");
+			}
+		else
+			{
+			fprintf(ofp, "# Output format:\n");
+			fprintf(ofp, "#      time_d tide\n");
+			fprintf(ofp, "# where time_d is in seconds since January 1, 1970\n");
+			fprintf(ofp, "# and tide is in meters\n");
+			}
+		right_now = time((time_t *)0);
+		strcpy(date,ctime(&right_now));
+		date[strlen(date)-1] = '\0';
+		if ((user_ptr = getenv("USER")) == NULL)
+			user_ptr = getenv("LOGNAME");
+		if (user_ptr != NULL)
+			strcpy(user,user_ptr);
+		else
+			strcpy(user, "unknown");
+		gethostname(host,MBP_FILENAMESIZE);
+		fprintf(ofp,"# Run by user <%s> on cpu <%s> at <%s>\n", user,host,date);
+
+		for (i=0;i<ntide;i++)
+			{
+			if (tideformat == 2)
+				{
+				mb_get_date(verbose, time_d[i], time_i);
+				fprintf(ofp, "%4.4d %2.2d %2.2d %2.2d %2.2d %2.2d %9.4f\n",
+					time_i[0], time_i[1],  time_i[2],
+					time_i[3], time_i[4],  time_i[5], tide[i]);
+				}
+			else
+				{
+				fprintf(ofp, "%.3f %9.4f\n",time_d[i], tide[i]);
+				}
+			}
+		fclose(ofp);
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBIO function <%s> completed\n",function_name);
+		fprintf(stderr,"dbg2  Revision id: %s\n",rcs_id);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:         %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:        %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
@@ -0,0 +1,310 @@
+/*--------------------------------------------------------------------
+ *    The MB-system:	mbotps_check.c	10/19/2026
+ *    $Id$
+ *
+ *    Copyright (c) 2009-2015 by
+ *    David W. Caress (caress@mbari.org)
+ *      Monterey Bay Aquarium Research Institute
+ *      Moss Landing, CA 95039
+ *    and Dale N. Chayes (dale@ldeo.columbia.edu)
+ *      Lamont-Doherty Earth Observatory
+ *      Palisades, NY 10964
+ *
+ *    See README file for copying and redistribution conditions.
+ *--------------------------------------------------------------------*/
+/*
+ * MBotps_check writes a small synthetic OTPS binary tide model to a
+ * temporary directory and checks the tide prediction built into
+ * mbotps against it:
+ *   - The harmonic constants of the model vary linearly across the
+ *     grid, so the interpolated constants must match the analytic
+ *     values exactly, including in the half cells outside the edge
+ *     nodes where the edge value is used.
+ *   - The predicted tides must match a direct evaluation of the
+ *     harmonic sum from those constants.
+ *   - If the OTPS program predict_tide is found (in the OTPS location
+ *     given on the command line, or the one mbotps was configured
+ *     with), the same points are also predicted with predict_tide.
+ *     The two are expected to agree to within a few percent of the
+ *     total amplitude, since predict_tide also infers the minor
+ *     constituents that the built in prediction leaves out.
+ *
+ * This program is not built or installed with MB-System. It includes
+ * mbotps.c directly so that the model functions can be called, and
+ * can be built in the otps build directory (where otps.h is made)
+ * with something like:
+ *      cc -I../mbio -I../gsf -o mbotps_check mbotps_check.c \
+ *              ../mbio/.libs/libmbio.a [GMT, netCDF, and proj libraries] -lm
+ * and run as:
+ *      mbotps_check [otps_location]
+ * The exit status is zero if all of the checks pass.
+ */
+
+/* the mbotps functions under test */
+#define main mbotps_main
+#include "mbotps.c"
+#undef main
+
+/* synthetic model dimensions and limits */
+#define CHECK_N		6
+#define CHECK_M		5
+#define CHECK_NC	8
+#define CHECK_LON_MIN	10.0
+#define CHECK_LON_MAX	13.0
+#define CHECK_LAT_MIN	20.0
+#define CHECK_LAT_MAX	22.5
+#define CHECK_NPOINT	9
+#define CHECK_NTIME	48
+#define CHECK_TOLERANCE	0.0001
+#define CHECK_OTPS_TOLERANCE	0.05
+
+static char *check_constituent[CHECK_NC] =
+	{ "m2  ", "s2  ", "n2  ", "k2  ", "k1  ", "o1  ", "p1  ", "q1  " };
+
+/*--------------------------------------------------------------------*/
+/* harmonic constants of the synthetic model at fractional node
+	position (x, y) - linear in both so bilinear interpolation
+	reproduces them exactly */
+static void check_constant(int k, double x, double y, double *re, double *im)
+{
+	*re = 0.5 / (k + 1) + 0.01 * (k + 1) * x - 0.02 * y;
+	*im = -0.2 / (k + 1) + 0.015 * x + 0.005 * (k + 1) * y;
+}
+/*--------------------------------------------------------------------*/
+/* write a big endian Fortran unformatted record */
+static void check_write_record(FILE *fp, char *buffer, int length)
+{
+	char	marker[4];
+
+	mb_put_binary_int(MB_NO, length, (void *) marker);
+	fwrite(marker, 1, 4, fp);
+	fwrite(buffer, 1, length, fp);
+	fwrite(marker, 1, 4, fp);
+}
+/*--------------------------------------------------------------------*/
+/* write the synthetic model control, elevation, and grid files */
+static int check_write_model(char *dir)
+{
+	mb_path	path;
+	FILE	*fp;
+	char	buffer[8 * CHECK_N * CHECK_M];
+	float	lims[4];
+	double	re, im;
+	int	i, j, k;
+
+	lims[0] = CHECK_LAT_MIN;
+	lims[1] = CHECK_LAT_MAX;
+	lims[2] = CHECK_LON_MIN;
+	lims[3] = CHECK_LON_MAX;
+
+	/* model control file - elevation, transport, and grid files */
+	sprintf(path, "%s/DATA", dir);
+	if (mkdir(path, 0755) != 0)
+		return(MB_FAILURE);
+	sprintf(path, "%s/DATA/Model_check", dir);
+	if ((fp = fopen(path, "w")) == NULL)
+		return(MB_FAILURE);
+	fprintf(fp, "%s/DATA/h_check\n%s/DATA/u_check\n%s/DATA/grid_check\n", dir, dir, dir);
+	fclose(fp);
+
+	/* elevation file - header then one complex grid per constituent */
+	sprintf(path, "%s/DATA/h_check", dir);
+	if ((fp = fopen(path, "wb")) == NULL)
+		return(MB_FAILURE);
+	mb_put_binary_int(MB_NO, CHECK_N, (void *) &buffer[0]);
+	mb_put_binary_int(MB_NO, CHECK_M, (void *) &buffer[4]);
+	mb_put_binary_int(MB_NO, CHECK_NC, (void *) &buffer[8]);
+	for (i=0;i<4;i++)
+		mb_put_binary_float(MB_NO, lims[i], (void *) &buffer[12+4*i]);
+	for (k=0;k<CHECK_NC;k++)
+		strncpy(&buffer[28+4*k], check_constituent[k], 4);
+	check_write_record(fp, buffer, 28 + 4 * CHECK_NC);
+	for (k=0;k<CHECK_NC;k++)
+		{
+		for (j=0;j<CHECK_M;j++)
+		for (i=0;i<CHECK_N;i++)
+			{
+			check_constant(k, (double) i, (double) j, &re, &im);
+			mb_put_binary_float(MB_NO, (float) re, (void *) &buffer[8*(j*CHECK_N+i)]);
+			mb_put_binary_float(MB_NO, (float) im, (void *) &buffer[8*(j*CHECK_N+i)+4]);
+			}
+		check_write_record(fp, buffer, 8 * CHECK_N * CHECK_M);
+		}
+	fclose(fp);
+
+	/* grid file - header, open boundary, depth, and mask records */
+	sprintf(path, "%s/DATA/grid_check", dir);
+	if ((fp = fopen(path, "wb")) == NULL)
+		return(MB_FAILURE);
+	mb_put_binary_int(MB_NO, CHECK_N, (void *) &buffer[0]);
+	mb_put_binary_int(MB_NO, CHECK_M, (void *) &buffer[4]);
+	for (i=0;i<4;i++)
+		mb_put_binary_float(MB_NO, lims[i], (void *) &buffer[8+4*i]);
+	mb_put_binary_float(MB_NO, 12.0, (void *) &buffer[24]);
+	mb_put_binary_int(MB_NO, 0, (void *) &buffer[28]);
+	check_write_record(fp, buffer, 32);
+	check_write_record(fp, buffer + 28, 4);
+	for (i=0;i<CHECK_N*CHECK_M;i++)
+		mb_put_binary_float(MB_NO, 1000.0, (void *) &buffer[4*i]);
+	check_write_record(fp, buffer, 4 * CHECK_N * CHECK_M);
+	for (i=0;i<CHECK_N*CHECK_M;i++)
+		mb_put_binary_int(MB_NO, 1, (void *) &buffer[4*i]);
+	check_write_record(fp, buffer, 4 * CHECK_N * CHECK_M);
+	fclose(fp);
+
+	return(MB_SUCCESS);
+}
+/*--------------------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+	int	verbose = 0;
+	int	error = MB_ERROR_NO_ERROR;
+	int	status = MB_SUCCESS;
+	struct mbotps_model_struct model;
+	char	dir[] = "/tmp/mbotps_checkXXXXXX";
+	mb_path	path;
+	mb_path	command;
+	char	*location;
+	double	plon[CHECK_NPOINT] =
+		{ 10.1, 10.25, 11.3, 12.8, 12.95, 10.1, 11.0, 12.9, 11.55 };
+	double	plat[CHECK_NPOINT] =
+		{ 20.1, 21.0, 20.05, 22.45, 21.3, 22.4, 20.25, 20.1, 21.75 };
+	double	lon[CHECK_NTIME], lat[CHECK_NTIME], time_d[CHECK_NTIME];
+	double	tide[CHECK_NTIME], tide_otps[CHECK_NTIME];
+	double	time_start;
+	double	x, y, re, im, t, arg, sum, amplitude;
+	double	diff, diffmax;
+	int	ngood, ngood_otps;
+	int	nfail = 0;
+	int	i, k, l;
+
+	/* write the synthetic model */
+	if (mkdtemp(dir) == NULL || check_write_model(dir) != MB_SUCCESS)
+		{
+		fprintf(stderr,"Unable to write the synthetic model in %s\n", dir);
+		exit(1);
+		}
+	if (mbotps_model_open(verbose, dir, "check", &model, &error) != MB_SUCCESS)
+		{
+		fprintf(stderr,"Unable to open the synthetic model in %s\n", dir);
+		exit(1);
+		}
+
+	/* the interpolated harmonic constants must equal the linear field
+		evaluated at the node position, clamped to the edge nodes */
+	diffmax = 0.0;
+	for (i=0;i<CHECK_NPOINT;i++)
+		{
+		status = mbotps_model_interp(verbose, &model, plon[i], plat[i], &error);
+		x = (plon[i] - model.lon_min) / model.dlon - 0.5;
+		y = (plat[i] - model.lat_min) / model.dlat - 0.5;
+		x = MIN(MAX(x, 0.0), CHECK_N - 1.0);
+		y = MIN(MAX(y, 0.0), CHECK_M - 1.0);
+		for (k=0;k<CHECK_NC && status == MB_SUCCESS;k++)
+			{
+			check_constant(k, x, y, &re, &im);
+			diffmax = MAX(diffmax, fabs(model.hc_re[k] - re));
+			diffmax = MAX(diffmax, fabs(model.hc_im[k] - im));
+			}
+		if (status != MB_SUCCESS)
+			diffmax = 1.0;
+		}
+	fprintf(stderr,"interpolated constants:       max difference %g\n", diffmax);
+	if (diffmax > CHECK_TOLERANCE)
+		nfail++;
+
+	/* predicted tides at each location must match the direct harmonic
+		sum - hourly over two days starting 2010/06/15 */
+	diffmax = 0.0;
+	amplitude = 0.0;
+	time_start = 1276560000.0;
+	for (i=0;i<CHECK_NPOINT;i++)
+		{
+		for (l=0;l<CHECK_NTIME;l++)
+			{
+			lon[l] = plon[i];
+			lat[l] = plat[i];
+			time_d[l] = time_start + 3600.0 * l;
+			}
+		status = mbotps_model_predict(verbose, &model, CHECK_NTIME, lon, lat,
+						time_d, tide, &ngood, &error);
+		if (status != MB_SUCCESS || ngood != CHECK_NTIME)
+			{
+			diffmax = 1.0;
+			continue;
+			}
+		mbotps_model_interp(verbose, &model, plon[i], plat[i], &error);
+		for (l=0;l<CHECK_NTIME;l++)
+			{
+			mbotps_model_nodal(verbose, &model,
+				floor(MBOTPS_MJD_EPOCH + time_d[l] / 86400.0) + 0.5, &error);
+			t = time_d[l] - MBOTPS_TIME_REF;
+			sum = 0.0;
+			for (k=0;k<CHECK_NC;k++)
+				{
+				arg = mbotps_constituent_omega[model.index[k]] * t
+					+ mbotps_constituent_phase[model.index[k]] + model.pu[k];
+				sum += model.pf[k] * (model.hc_re[k] * cos(arg)
+							- model.hc_im[k] * sin(arg));
+				if (l == 0 && i == 0)
+					amplitude += sqrt(model.hc_re[k] * model.hc_re[k]
+							+ model.hc_im[k] * model.hc_im[k]);
+				}
+			diffmax = MAX(diffmax, fabs(tide[l] - sum));
+			}
+		}
+	fprintf(stderr,"predicted tides:              max difference %g\n", diffmax);
+	if (diffmax > CHECK_TOLERANCE)
+		nfail++;
+
+	/* compare with predict_tide when it is available */
+	location = (argc > 1 ? argv[1] : otps_location);
+	sprintf(path, "%s/predict_tide", location);
+	if (access(path, X_OK) == 0)
+		{
+		sprintf(command, "ln -s %s %s/predict_tide", path, dir);
+		if (system(command) != 0)
+			nfail++;
+		diffmax = 0.0;
+		for (i=0;i<CHECK_NPOINT;i++)
+			{
+			for (l=0;l<CHECK_NTIME;l++)
+				{
+				lon[l] = plon[i];
+				lat[l] = plat[i];
+				time_d[l] = time_start + 3600.0 * l;
+				}
+			mbotps_model_predict(verbose, &model, CHECK_NTIME, lon, lat,
+						time_d, tide, &ngood, &error);
+			for (l=0;l<CHECK_NTIME;l++)
+				time_d[l] = time_start + 3600.0 * l;
+			status = mbotps_predict_external(verbose, dir, "check", CHECK_NTIME,
+						lon, lat, time_d, tide_otps, &ngood_otps, &error);
+			if (status != MB_SUCCESS || ngood_otps != ngood)
+				{
+				diffmax = amplitude;
+				continue;
+				}
+			for (l=0;l<ngood;l++)
+				{
+				diff = fabs(tide[l] - tide_otps[l]);
+				diffmax = MAX(diffmax, diff);
+				}
+			}
+		fprintf(stderr,"predict_tide:                 max difference %g of amplitude %g\n",
+			diffmax, amplitude);
+		if (diffmax > CHECK_OTPS_TOLERANCE * amplitude)
+			nfail++;
+		}
+	else
+		fprintf(stderr,"predict_tide:                 not found in %s, not compared\n", location);
+
+	/* clean up */
+	mbotps_model_close(verbose, &model, &error);
+	sprintf(command, "rm -rf %s", dir);
+	system(command);
+
+	fprintf(stderr,"%d check%s failed\n", nfail, (nfail == 1 ? "" : "s"));
+	exit(nfail > 0 ? 1 : 0);
+}
+/*--------------------------------------------------------------------*/
@@ -49,6 +49,9 @@
 #define	MBBACKANGLE_BEAMPATTERN_EMPIRICAL		0
 #define	MBBACKANGLE_BEAMPATTERN_SIDESCAN		1
 
+/* number of columns of per file sums cached for -U updates */
+#define	MBBACKANGLE_NSUMS	6
+
 /* define grid structure */
 struct mbba_grid_struct
 	{
@@ -82,6 +85,24 @@ int output_model(int verbose, FILE *tfp,
 	int nangles, double angle_max, double dangle, int symmetry,
 	int *nmean, double *mean, double *sigma,
 	int *error);
+int get_sums_key(int verbose, char *swathfile, int format, char *parameters,
+	int *key, int *error);
+int add_sums(int verbose, int nangles,
+	int *nmean, double *mean, double *sigma,
+	int *nmeantot, double *meantot, double *sigmatot,
+	int *error);
+int read_sums(int verbose, char *swathfile, int key, int nangles,
+	int *nping, double *time_d_sum, double *altitude_sum,
+	int *nrec, int *namp, int *nss, int *ss_corr_type,
+	int *nmeanamp, double *meanamp, double *sigmaamp,
+	int *nmeanss, double *meanss, double *sigmass,
+	int *error);
+int write_sums(int verbose, char *swathfile, int key, int nangles,
+	int nping, double time_d_sum, double altitude_sum,
+	int nrec, int namp, int nss, int ss_corr_type,
+	int *nmeanamp, double *meanamp, double *sigmaamp,
+	int *nmeanss, double *meanss, double *sigmass,
+	int *error);
 
 static char rcs_id[] = "$Id$";
 char program_name[] = "mbbackangle";
@@ -97,10 +118,11 @@ as a function of the angle of interaction (grazing angle) \n\t\
 with the seafloor. Each table represents the symmetrical \n\t\
 average function for a user defined number of pings. The tables \n\t\
 are output to a \".aga\" and \".sga\" files that can be applied \n\t\
-by MBprocess.";
+by MBprocess. The per file sums are cached so that with -U only \n\t\
+files that have changed since the last run are read again.";
 	char usage_message[] = "mbbackangle -Ifile \
 [-Akind -Bmode[/beamwidth/depression] -Fformat -Ggridmode/angle/min/max/nx/ny \
--Nnangles/angle_max -Ppings -Q -Rrefangle -Ttopogridfile -Zaltitude -V -H]";
+-Nnangles/angle_max -Ppings -Q -Rrefangle -Ttopogridfile -U -Zaltitude -V -H]";
 	extern char *optarg;
 	int	errflg = 0;
 	int	c;
@@ -201,11 +223,20 @@ by MBprocess.";
 	int	*nmeantotss = NULL;
 	double	*meantotss = NULL;
 	double	*sigmatotss = NULL;
+	int	nfileavg;
+	int	*nmeanfileamp = NULL;
+	double	*meanfileamp = NULL;
+	double	*sigmafileamp = NULL;
+	int	*nmeanfiless = NULL;
+	double	*meanfiless = NULL;
+	double	*sigmafiless = NULL;
 	double	altitude_default = 0.0;
 	double	time_d_avg;
 	double	altitude_avg;
 	double	time_d_totavg;
 	double	altitude_totavg;
+	double	time_d_fileavg;
+	double	altitude_fileavg;
 	int	beammode = MBBACKANGLE_BEAMPATTERN_EMPIRICAL;
 	double	ssbeamwidth = 50.0;
 	double	ssdepression = 20.0;
@@ -268,6 +299,14 @@ by MBprocess.";
 	int	mode;
 	int	plot_status;
 
+	/* cached per file sums */
+	int	update = MB_NO;
+	int	cached;
+	int	sumskey;
+	int	nfilecached = 0;
+	char	sumsparameters[MB_PATH_MAXLINE];
+	struct stat file_status;
+
 	/* time, user, host variables */
 	time_t	right_now;
 	char	date[32], user[MB_PATH_MAXLINE], *user_ptr, host[MB_PATH_MAXLINE];
@@ -295,7 +334,7 @@ by MBprocess.";
 	memset(&grid, 0, sizeof (struct mbba_grid_struct));
 
 	/* process argument list */
-	while ((c = getopt(argc, argv, "A:a:B:b:CcDdF:f:G:g:HhI:i:N:n:P:p:QqR:r:T:t:VvZ:z:")) != -1)
+	while ((c = getopt(argc, argv, "A:a:B:b:CcDdF:f:G:g:HhI:i:N:n:P:p:QqR:r:T:t:UuVvZ:z:")) != -1)
 	  switch (c)
 		{
 		case 'A':
@@ -403,6 +442,11 @@ by MBprocess.";
 			corr_topogrid = MB_YES;
 			flag++;
 			break;
+		case 'U':
+		case 'u':
+			update = MB_YES;
+			flag++;
+			break;
 		case 'V':
 		case 'v':
 			verbose++;
@@ -496,6 +540,7 @@ by MBprocess.";
 		fprintf(stderr,"dbg2       timegap:      %f\n",timegap);
 		fprintf(stderr,"dbg2       read_file:    %s\n",read_file);
 		fprintf(stderr,"dbg2       dump:         %d\n",dump);
+		fprintf(stderr,"dbg2       update:       %d\n",update);
 		fprintf(stderr,"dbg2       symmetry:     %d\n",symmetry);
 		fprintf(stderr,"dbg2       amplitude_on: %d\n",amplitude_on);
 		fprintf(stderr,"dbg2       sidescan_on:  %d\n",sidescan_on);
@@ -559,6 +604,15 @@ by MBprocess.";
 		if (error == MB_ERROR_NO_ERROR)
 			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
 				(void **)&sigmatotamp,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(int),
+				(void **)&nmeanfileamp,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
+				(void **)&meanfileamp,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
+				(void **)&sigmafileamp,&error);
 		}
 	if (sidescan_on == MB_YES)
 		{
@@ -580,6 +634,15 @@ by MBprocess.";
 		if (error == MB_ERROR_NO_ERROR)
 			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
 				(void **)&sigmatotss,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(int),
+				(void **)&nmeanfiless,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
+				(void **)&meanfiless,&error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_mallocd(verbose,__FILE__,__LINE__,nangles*sizeof(double),
+				(void **)&sigmafiless,&error);
 		}
 
 	/* if error initializing memory then quit */
@@ -627,6 +690,18 @@ by MBprocess.";
 	dangle = 2 * angle_max / (nangles-1);
 	angle_start = -angle_max - 0.5*dangle;
 
+	/* get the parameters that the cached per file sums depend on,
+		including the size and modification time of any topography
+		grid so that sums are recalculated when the grid changes */
+	sprintf(sumsparameters, "%d %f %d %d %d %d %d %f %f %d %d %d %s %f %f %f",
+		nangles, angle_max, pings_avg, symmetry, amplitude_on, sidescan_on,
+		beammode, ssbeamwidth, ssdepression, nsmooth, corr_slope,
+		corr_topogrid, grid.file, altitude_default, ref_angle_default,
+		timegap);
+	if (corr_topogrid == MB_YES && stat(grid.file, &file_status) == 0)
+		sprintf(&sumsparameters[strlen(sumsparameters)], " %ld %ld",
+			(long) file_status.st_size, (long) file_status.st_mtime);
+
 	/* initialize histogram */
 	if (amplitude_on == MB_YES)
 	for (i=0;i<nangles;i++)
@@ -803,9 +878,93 @@ by MBprocess.";
 	{
 
 	/* obtain format array location - format id will
-		be aliased to current id if old format id given */
+		be aliased to current id if old format id given,
+		which must be done before the cached sums are looked up
+		so that the key matches the one written after reading */
 	status = mb_format(verbose,&format,&error);
 
+	/* with -U use the sums cached by an earlier run if neither the
+	    swath file, its beam edits nor the table parameters have
+	    changed - the per file tables from that run are left in place */
+	cached = MB_NO;
+	if (update == MB_YES && dump == MB_NO
+		&& gridamp == MB_NO && gridss == MB_NO)
+		{
+		sprintf(amptablefile, "%s.aga", swathfile);
+		sprintf(sstablefile, "%s.sga", swathfile);
+		get_sums_key(verbose, swathfile, format, sumsparameters,
+				&sumskey, &error);
+		if ((amplitude_on == MB_NO || stat(amptablefile, &file_status) == 0)
+			&& (sidescan_on == MB_NO || stat(sstablefile, &file_status) == 0)
+			&& read_sums(verbose, swathfile, sumskey, nangles,
+				&nfileavg, &time_d_fileavg, &altitude_fileavg,
+				&nrec, &namp, &nss, &ss_corr_type,
+				nmeanfileamp, meanfileamp, sigmafileamp,
+				nmeanfiless, meanfiless, sigmafiless,
+				&error) == MB_SUCCESS)
+			cached = MB_YES;
+		else
+			error = MB_ERROR_NO_ERROR;
+		}
+	if (cached == MB_YES)
+		{
+		if (verbose > 0)
+			fprintf(stderr, "\nusing cached sums for swath file: %s %d\n",
+				swathfile, format);
+		nfilecached++;
+		ntable = 0;
+		amp_corr_type = MBP_AMPCORR_SUBTRACTION;
+		ref_angle = ref_angle_default;
+		if (esf.nedit > 0)
+			mb_esf_close(verbose, &esf, &error);
+
+		/* add the sums for this file into the totals */
+		ntotavg += nfileavg;
+		time_d_totavg += time_d_fileavg;
+		altitude_totavg += altitude_fileavg;
+		if (amplitude_on == MB_YES)
+			add_sums(verbose, nangles, nmeanfileamp, meanfileamp, sigmafileamp,
+					nmeantotamp, meantotamp, sigmatotamp, &error);
+		if (sidescan_on == MB_YES)
+			add_sums(verbose, nangles, nmeanfiless, meanfiless, sigmafiless,
+					nmeantotss, meantotss, sigmatotss, &error);
+		ntabletot += ntable;
+		nrectot += nrec;
+		namptot += namp;
+		nsstot += nss;
+
+		/* set amplitude correction in parameter file */
+		if (amplitude_on == MB_YES)
+			status = mb_pr_update_ampcorr(verbose, swathfile,
+				MB_YES, amptablefile,
+				amp_corr_type, corr_symmetry, ref_angle, amp_corr_slope,
+				grid.file, &error);
+
+		/* set sidescan correction in parameter file */
+		if (sidescan_on == MB_YES)
+			status = mb_pr_update_sscorr(verbose, swathfile,
+				MB_YES, sstablefile,
+				ss_corr_type, corr_symmetry, ref_angle, ss_corr_slope,
+				grid.file, &error);
+
+		/* figure out whether and what to read next */
+	        if (read_datalist == MB_YES)
+	                {
+			if ((status = mb_datalist_read(verbose,datalist,
+				    swathfile,&format,&file_weight,&error))
+				    == MB_SUCCESS)
+	                        read_data = MB_YES;
+	                else
+	                        read_data = MB_NO;
+	                }
+	        else
+	                {
+	                read_data = MB_NO;
+	                }
+
+		continue;
+		}
+
 	/* initialize reading the swath sonar file */
 	if ((status = mb_read_init(
 		verbose,swathfile,format,1,lonflip,bounds,
@@ -1062,6 +1221,23 @@ by MBprocess.";
 	nss = 0;
 	navg = 0;
 	ntable = 0;
+	nfileavg = 0;
+	time_d_fileavg = 0.0;
+	altitude_fileavg = 0.0;
+	if (amplitude_on == MB_YES)
+	for (i=0;i<nangles;i++)
+		{
+		nmeanfileamp[i] = 0;
+		meanfileamp[i] = 0.0;
+		sigmafileamp[i] = 0.0;
+		}
+	if (sidescan_on == MB_YES)
+	for (i=0;i<nangles;i++)
+		{
+		nmeanfiless[i] = 0;
+		meanfiless[i] = 0.0;
+		sigmafiless[i] = 0.0;
+		}
 
 	/* read and process data */
 	while (error <= MB_ERROR_NO_ERROR)
@@ -1171,13 +1347,13 @@ by MBprocess.";
 		    /* increment record counter */
 		    nrec++;
 		    navg++;
-		    ntotavg++;
+		    nfileavg++;
 
 		    /* increment time */
 		    time_d_avg += time_d;
 		    altitude_avg += altitude;
-		    time_d_totavg += time_d;
-		    altitude_totavg += altitude;
+		    time_d_fileavg += time_d;
+		    altitude_fileavg += altitude;
 
 		    /* get the seafloor slopes */
 		    if (beams_bath > 0)
@@ -1321,9 +1497,9 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 				    meanamp[j] += amp[i];
 				    sigmaamp[j] += amp[i]*amp[i];
 				    nmeanamp[j]++;
-				    meantotamp[j] += amp[i];
-				    sigmatotamp[j] += amp[i]*amp[i];
-				    nmeantotamp[j]++;
+				    meanfileamp[j] += amp[i];
+				    sigmafileamp[j] += amp[i]*amp[i];
+				    nmeanfileamp[j]++;
 				    }
 
 				/* load amplitude into grid */
@@ -1477,9 +1653,9 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 				    meanss[j] += ss[i];
 				    sigmass[j] += ss[i]*ss[i];
 				    nmeanss[j]++;
-				    meantotss[j] += ss[i];
-				    sigmatotss[j] += ss[i]*ss[i];
-				    nmeantotss[j]++;
+				    meanfiless[j] += ss[i];
+				    sigmafiless[j] += ss[i]*ss[i];
+				    nmeanfiless[j]++;
 				    }
 
 				/* load amplitude into grid */
@@ -1517,6 +1693,35 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 		fclose(atfp);
 	if (dump == MB_NO && sidescan_on == MB_YES)
 		fclose(stfp);
+
+	/* save the sums for this file so that a later -U run can use
+	    them instead of reading the file again */
+	if (dump == MB_NO)
+		{
+		get_sums_key(verbose, swathfile, format, sumsparameters,
+				&sumskey, &error);
+		status = write_sums(verbose, swathfile, sumskey, nangles,
+				nfileavg, time_d_fileavg, altitude_fileavg,
+				nrec, namp, nss, ss_corr_type,
+				nmeanfileamp, meanfileamp, sigmafileamp,
+				nmeanfiless, meanfiless, sigmafiless, &error);
+		if (status == MB_FAILURE)
+			{
+			status = MB_SUCCESS;
+			error = MB_ERROR_NO_ERROR;
+			}
+		}
+
+	/* add the sums for this file into the totals */
+	ntotavg += nfileavg;
+	time_d_totavg += time_d_fileavg;
+	altitude_totavg += altitude_fileavg;
+	if (amplitude_on == MB_YES)
+		add_sums(verbose, nangles, nmeanfileamp, meanfileamp, sigmafileamp,
+				nmeantotamp, meantotamp, sigmatotamp, &error);
+	if (sidescan_on == MB_YES)
+		add_sums(verbose, nangles, nmeanfiless, meanfiless, sigmafiless,
+				nmeantotss, meantotss, sigmatotss, &error);
 	ntabletot += ntable;
 	nrectot += nrec;
 	namptot += namp;
@@ -1786,6 +1991,8 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 	if (error == MB_ERROR_NO_ERROR && verbose > 0)
 	    {
 	    fprintf(stderr, "\n%d total records processed\n", nrectot);
+	    if (update == MB_YES)
+		fprintf(stderr, "%d files used cached sums\n", nfilecached);
 	    if (amplitude_on == MB_YES)
 		{
 		fprintf(stderr, "%d total amplitude data processed\n", namptot);
@@ -1807,6 +2014,9 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&nmeantotamp,&error);
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&meantotamp,&error);
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&sigmatotamp,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&nmeanfileamp,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&meanfileamp,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&sigmafileamp,&error);
 		if (gridamp == MB_YES)
 			{
 			mb_freed(verbose,__FILE__, __LINE__, (void **)&gridamphist,&error);
@@ -1820,6 +2030,9 @@ r[0],r[1],r[2],v1[0],v1[1],v1[2],v2[0],v2[1],v2[2],v[0],v[1],v[2],angle);*/
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&nmeantotss,&error);
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&meantotss,&error);
 		mb_freed(verbose,__FILE__, __LINE__, (void **)&sigmatotss,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&nmeanfiless,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&meanfiless,&error);
+		mb_freed(verbose,__FILE__, __LINE__, (void **)&sigmafiless,&error);
 		if (gridss == MB_YES)
 			{
 			mb_freed(verbose,__FILE__, __LINE__, (void **)&gridsshist,&error);
@@ -2060,3 +2273,264 @@ int output_model(int verbose, FILE *tfp,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+/*--------------------------------------------------------------------*/
+int get_sums_key(int verbose, char *swathfile, int format, char *parameters,
+	int *key, int *error)
+{
+	char	*function_name = "get_sums_key";
+	int	status = MB_SUCCESS;
+	mb_path	esffile;
+	char	keystring[2*MB_PATH_MAXLINE];
+	unsigned int hash;
+	int	i;
+
+	/* file status variables */
+	struct stat file_status;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       swathfile:       %s\n", swathfile);
+		fprintf(stderr,"dbg2       format:          %d\n", format);
+		fprintf(stderr,"dbg2       parameters:      %s\n", parameters);
+		}
+
+	/* the sums depend on the table parameters and on any beam
+		edits saved for the swath file */
+	sprintf(esffile, "%s.esf", swathfile);
+	if (stat(esffile, &file_status) == 0)
+		sprintf(keystring, "%s %d %s %ld %ld", program_name, format, parameters,
+			(long) file_status.st_size, (long) file_status.st_mtime);
+	else
+		sprintf(keystring, "%s %d %s", program_name, format, parameters);
+	hash = 5381;
+	for (i=0;keystring[i] != '\0';i++)
+		hash = hash * 33 + (unsigned char) keystring[i];
+	*key = (int) (hash & 0x7fffffff);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       key:             %d\n",*key);
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int add_sums(int verbose, int nangles,
+	int *nmean, double *mean, double *sigma,
+	int *nmeantot, double *meantot, double *sigmatot,
+	int *error)
+{
+	char	*function_name = "add_sums";
+	int	status = MB_SUCCESS;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       nangles:         %d\n", nangles);
+		fprintf(stderr,"dbg2       sums:\n");
+		for (i=0;i<nangles;i++)
+			fprintf(stderr,"dbg2         %d %d %f %f\n",
+				i, nmean[i], mean[i], sigma[i]);
+		}
+
+	/* add the sums for one file into the totals */
+	for (i=0;i<nangles;i++)
+		{
+		nmeantot[i] += nmean[i];
+		meantot[i] += mean[i];
+		sigmatot[i] += sigma[i];
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int read_sums(int verbose, char *swathfile, int key, int nangles,
+	int *nping, double *time_d_sum, double *altitude_sum,
+	int *nrec, int *namp, int *nss, int *ss_corr_type,
+	int *nmeanamp, double *meanamp, double *sigmaamp,
+	int *nmeanss, double *meanss, double *sigmass,
+	int *error)
+{
+	char	*function_name = "read_sums";
+	int	status = MB_SUCCESS;
+	double	*columns[MBBACKANGLE_NSUMS];
+	double	**columnptrs[MBBACKANGLE_NSUMS];
+	int	nrecord;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       swathfile:       %s\n", swathfile);
+		fprintf(stderr,"dbg2       key:             %d\n", key);
+		fprintf(stderr,"dbg2       nangles:         %d\n", nangles);
+		}
+
+	/* the first record holds the per file counts and sums, the
+		remaining records the amplitude and sidescan angle bins */
+	for (i=0;i<MBBACKANGLE_NSUMS;i++)
+		{
+		columns[i] = NULL;
+		columnptrs[i] = &columns[i];
+		}
+	status = mb_pr_readcache(verbose, swathfile, key,
+			MBBACKANGLE_NSUMS, &nrecord, columnptrs,
+			ss_corr_type, error);
+	if (status == MB_SUCCESS && nrecord != nangles + 1)
+		{
+		for (i=0;i<MBBACKANGLE_NSUMS;i++)
+			mb_freed(verbose,__FILE__, __LINE__, (void **)&columns[i],error);
+		status = MB_FAILURE;
+		*error = MB_ERROR_BAD_PARAMETER;
+		}
+	if (status == MB_SUCCESS)
+		{
+		*nping = (int) columns[0][0];
+		*time_d_sum = columns[1][0];
+		*altitude_sum = columns[2][0];
+		*nrec = (int) columns[3][0];
+		*namp = (int) columns[4][0];
+		*nss = (int) columns[5][0];
+		for (i=0;i<nangles;i++)
+			{
+			if (nmeanamp != NULL)
+				{
+				nmeanamp[i] = (int) columns[0][i+1];
+				meanamp[i] = columns[1][i+1];
+				sigmaamp[i] = columns[2][i+1];
+				}
+			if (nmeanss != NULL)
+				{
+				nmeanss[i] = (int) columns[3][i+1];
+				meanss[i] = columns[4][i+1];
+				sigmass[i] = columns[5][i+1];
+				}
+			}
+		for (i=0;i<MBBACKANGLE_NSUMS;i++)
+			mb_freed(verbose,__FILE__, __LINE__, (void **)&columns[i],error);
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       nping:           %d\n",*nping);
+		fprintf(stderr,"dbg2       nrec:            %d\n",*nrec);
+		fprintf(stderr,"dbg2       ss_corr_type:    %d\n",*ss_corr_type);
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int write_sums(int verbose, char *swathfile, int key, int nangles,
+	int nping, double time_d_sum, double altitude_sum,
+	int nrec, int namp, int nss, int ss_corr_type,
+	int *nmeanamp, double *meanamp, double *sigmaamp,
+	int *nmeanss, double *meanss, double *sigmass,
+	int *error)
+{
+	char	*function_name = "write_sums";
+	int	status = MB_SUCCESS;
+	double	*columns[MBBACKANGLE_NSUMS];
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n", verbose);
+		fprintf(stderr,"dbg2       swathfile:       %s\n", swathfile);
+		fprintf(stderr,"dbg2       key:             %d\n", key);
+		fprintf(stderr,"dbg2       nangles:         %d\n", nangles);
+		fprintf(stderr,"dbg2       nping:           %d\n", nping);
+		fprintf(stderr,"dbg2       nrec:            %d\n", nrec);
+		fprintf(stderr,"dbg2       ss_corr_type:    %d\n", ss_corr_type);
+		}
+
+	/* pack the sums into columns in the same layout read_sums expects */
+	for (i=0;i<MBBACKANGLE_NSUMS;i++)
+		columns[i] = NULL;
+	for (i=0;i<MBBACKANGLE_NSUMS && status == MB_SUCCESS;i++)
+		status = mb_mallocd(verbose,__FILE__,__LINE__,(nangles+1)*sizeof(double),
+				(void **)&columns[i],error);
+	if (status == MB_SUCCESS)
+		{
+		columns[0][0] = (double) nping;
+		columns[1][0] = time_d_sum;
+		columns[2][0] = altitude_sum;
+		columns[3][0] = (double) nrec;
+		columns[4][0] = (double) namp;
+		columns[5][0] = (double) nss;
+		for (i=0;i<nangles;i++)
+			{
+			columns[0][i+1] = (nmeanamp != NULL ? (double) nmeanamp[i] : 0.0);
+			columns[1][i+1] = (nmeanamp != NULL ? meanamp[i] : 0.0);
+			columns[2][i+1] = (nmeanamp != NULL ? sigmaamp[i] : 0.0);
+			columns[3][i+1] = (nmeanss != NULL ? (double) nmeanss[i] : 0.0);
+			columns[4][i+1] = (nmeanss != NULL ? meanss[i] : 0.0);
+			columns[5][i+1] = (nmeanss != NULL ? sigmass[i] : 0.0);
+			}
+		status = mb_pr_writecache(verbose, swathfile, key,
+				MBBACKANGLE_NSUMS, nangles + 1, columns,
+				ss_corr_type, error);
+		}
+	for (i=0;i<MBBACKANGLE_NSUMS;i++)
+		if (columns[i] != NULL)
+			mb_freed(verbose,__FILE__, __LINE__, (void **)&columns[i],error);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBBACKANGLE function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
@@ -151,6 +151,12 @@ int contrast_edge(int verbose, int n, double *val, double *grad,
 		double *result, int *error);
 int contrast_gradient(int verbose, int n, double *val, double *wgt,
 		double *result, int *error);
+int filter_window_sums(int verbose, int mode, int ndata,
+		struct mbfilter_ping_struct *ping, int ndx, int ndl,
+		int *error);
+int filter_window_median(int verbose, struct mbfilter_filter_struct *filter,
+		int ndata, struct mbfilter_ping_struct *ping, int ndx, int ndl,
+		int *error);
 int mbcopy_any_to_mbldeoih(int verbose, int system,
 		int kind, int *time_i, double time_d,
 		double navlon, double navlat, double speed, double heading,
@@ -301,6 +307,7 @@ The default input and output streams are stdin and stdout.\n";
 	double	ddis;
 	int	ndatapts;
 	int	ifilter, ndx, ndl;
+	int	fastfilter;
 	int	ia,  ib;
 	int	ja,  jb,  jbeg,  jend;
 	int	i, j, ii, jj, n;
@@ -1143,8 +1150,33 @@ done, jbeg, jend, ndata, nhold_ping, nhold);*/
 				  ping[j].data_f_ptr = ping[j].dataprocess;
 				  }
 
+				/* use the separable running sum or sliding median
+				    form of the filter where one applies */
+				fastfilter = MB_NO;
+				if (filters[ifilter].mode == MBFILTER_A_HIPASS_MEAN
+				    || filters[ifilter].mode == MBFILTER_A_HIPASS_GAUSSIAN
+				    || filters[ifilter].mode == MBFILTER_A_SMOOTH_MEAN
+				    || filters[ifilter].mode == MBFILTER_A_SMOOTH_GAUSSIAN)
+				  {
+				  status = filter_window_sums(verbose, filters[ifilter].mode,
+						ndata, ping, ndx, ndl, &error);
+				  fastfilter = (status == MB_SUCCESS ? MB_YES : MB_NO);
+				  }
+				else if (filters[ifilter].mode == MBFILTER_A_HIPASS_MEDIAN
+				    || filters[ifilter].mode == MBFILTER_A_SMOOTH_MEDIAN)
+				  {
+				  status = filter_window_median(verbose, &filters[ifilter],
+						ndata, ping, ndx, ndl, &error);
+				  fastfilter = (status == MB_SUCCESS ? MB_YES : MB_NO);
+				  }
+				if (fastfilter == MB_NO)
+				  {
+				  status = MB_SUCCESS;
+				  error = MB_ERROR_NO_ERROR;
+				  }
+
 				/* loop over all the data */
-				for (j=0;j<ndata;j++)
+				for (j=0;j<ndata && fastfilter == MB_NO;j++)
 				  {
 
 				  /* get beginning and end pings */
@@ -1464,6 +1496,335 @@ nunload,nwrite,verbose,error,ombio_ptr,omb_io_ptr->store_data);*/
 	exit(error);
 }
 /*--------------------------------------------------------------------*/
+int filter_window_sums(int verbose, int mode, int ndata,
+		struct mbfilter_ping_struct *ping, int ndx, int ndl,
+		int *error)
+{
+	char	*function_name = "filter_window_sums";
+	int	status = MB_SUCCESS;
+	double	*colsum = NULL;
+	double	*colwgt = NULL;
+	double	*sumcum = NULL;
+	double	*wgtcum = NULL;
+	double	edgewgt, ewgt, w;
+	double	sum, wgtsum;
+	int	gaussian;
+	int	nmax;
+	int	ja, jb, ia, ib;
+	int	i, ii, j, jj;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBFILTER function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n",verbose);
+		fprintf(stderr,"dbg2       mode:            %d\n",mode);
+		fprintf(stderr,"dbg2       ndata:           %d\n",ndata);
+		fprintf(stderr,"dbg2       ping:            %p\n",(void *)ping);
+		fprintf(stderr,"dbg2       ndx:             %d\n",ndx);
+		fprintf(stderr,"dbg2       ndl:             %d\n",ndl);
+		}
+
+	/* The gaussian weights in the general filter loop are computed as
+	    exp(-(di*di/(ndx*ndx) + dj*dj/(ndl*ndl))) using integer ratios,
+	    so along each axis a sample has weight 1 unless it sits exactly
+	    on the window edge, where it has weight exp(-1). That makes the
+	    weighting separable, and a window sum reduces to per-column
+	    sums over the pings plus a running sum across the columns, with
+	    the edge columns rescaled. The mean filters are the same thing
+	    with all weights equal to one. */
+	gaussian = (mode == MBFILTER_A_HIPASS_GAUSSIAN
+			|| mode == MBFILTER_A_SMOOTH_GAUSSIAN);
+	edgewgt = exp(-1.0);
+	ewgt = 1.0 - edgewgt;
+
+	/* allocate column and running sum arrays */
+	nmax = 0;
+	for (j=0;j<ndata;j++)
+		nmax = MAX(nmax, ping[j].ndatapts);
+	status = mb_mallocd(verbose,__FILE__,__LINE__,(nmax+1)*sizeof(double),
+				(void **)&colsum,error);
+	if (status == MB_SUCCESS)
+		status = mb_mallocd(verbose,__FILE__,__LINE__,(nmax+1)*sizeof(double),
+				(void **)&colwgt,error);
+	if (status == MB_SUCCESS)
+		status = mb_mallocd(verbose,__FILE__,__LINE__,(nmax+1)*sizeof(double),
+				(void **)&sumcum,error);
+	if (status == MB_SUCCESS)
+		status = mb_mallocd(verbose,__FILE__,__LINE__,(nmax+1)*sizeof(double),
+				(void **)&wgtcum,error);
+
+	/* loop over all the data */
+	for (j=0;j<ndata && status == MB_SUCCESS;j++)
+		{
+		/* get beginning and end pings */
+		ja = j - ndl;
+		jb = j + ndl;
+		if (ja < 0) ja = 0;
+		if (jb >= ndata) jb = ndata - 1;
+
+		/* sum the valid values in each column of the ping window */
+		for (ii=0;ii<ping[j].ndatapts;ii++)
+			{
+			colsum[ii] = 0.0;
+			colwgt[ii] = 0.0;
+			}
+		for (jj=ja;jj<=jb;jj++)
+			{
+			w = 1.0;
+			if (gaussian == MB_YES && ndl > 0
+				&& (jj - j == ndl || j - jj == ndl))
+				w = edgewgt;
+			for (ii=0;ii<ping[j].ndatapts;ii++)
+				{
+				if (mb_beam_ok(ping[jj].flag_ptr[ii]))
+					{
+					colsum[ii] += w * ping[jj].data_i_ptr[ii];
+					colwgt[ii] += w;
+					}
+				}
+			}
+
+		/* get running sums across the columns */
+		sumcum[0] = 0.0;
+		wgtcum[0] = 0.0;
+		for (ii=0;ii<ping[j].ndatapts;ii++)
+			{
+			sumcum[ii+1] = sumcum[ii] + colsum[ii];
+			wgtcum[ii+1] = wgtcum[ii] + colwgt[ii];
+			}
+
+		/* loop over each value */
+		for (i=0;i<ping[j].ndatapts;i++)
+			{
+			/* only filter valid values */
+			if (!mb_beam_ok(ping[j].flag_ptr[i]))
+				{
+				ping[j].data_f_ptr[i] = MB_SIDESCAN_NULL;
+				continue;
+				}
+
+			/* get beginning and end values */
+			ia = i - ndx;
+			ib = i + ndx;
+			if (ia < 0) ia = 0;
+			if (ib >= ping[j].ndatapts) ib = ping[j].ndatapts - 1;
+
+			/* get window sums */
+			sum = sumcum[ib+1] - sumcum[ia];
+			wgtsum = wgtcum[ib+1] - wgtcum[ia];
+			if (gaussian == MB_YES && ndx > 0)
+				{
+				if (i - ndx >= ia)
+					{
+					sum -= ewgt * colsum[i-ndx];
+					wgtsum -= ewgt * colwgt[i-ndx];
+					}
+				if (i + ndx <= ib)
+					{
+					sum -= ewgt * colsum[i+ndx];
+					wgtsum -= ewgt * colwgt[i+ndx];
+					}
+				}
+
+			/* get filtered value */
+			ping[j].data_f_ptr[i] = 0.0;
+			if (wgtsum > 0.0)
+				{
+				if (mode == MBFILTER_A_HIPASS_MEAN
+					|| mode == MBFILTER_A_HIPASS_GAUSSIAN)
+					ping[j].data_f_ptr[i] = ping[j].data_i_ptr[i]
+								- sum / wgtsum;
+				else
+					ping[j].data_f_ptr[i] = sum / wgtsum;
+				}
+			}
+		}
+
+	/* deallocate arrays */
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&colsum,error);
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&colwgt,error);
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&sumcum,error);
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&wgtcum,error);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBFILTER function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
+int filter_window_median(int verbose, struct mbfilter_filter_struct *filter,
+		int ndata, struct mbfilter_ping_struct *ping, int ndx, int ndl,
+		int *error)
+{
+	char	*function_name = "filter_window_median";
+	int	status = MB_SUCCESS;
+	double	*val = NULL;
+	double	value, ratio;
+	int	nvalmax, nval;
+	int	ja, jb, ia, ib, wa, wb;
+	int	lo, hi, mid;
+	int	i, j, jj;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBFILTER function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:         %d\n",verbose);
+		fprintf(stderr,"dbg2       mode:            %d\n",filter->mode);
+		fprintf(stderr,"dbg2       ndata:           %d\n",ndata);
+		fprintf(stderr,"dbg2       ping:            %p\n",(void *)ping);
+		fprintf(stderr,"dbg2       ndx:             %d\n",ndx);
+		fprintf(stderr,"dbg2       ndl:             %d\n",ndl);
+		}
+
+	/* The window values are kept in a sorted array as the window
+	    slides across each ping, so each step inserts the column entering
+	    the window and deletes the column leaving it rather than sorting
+	    the whole window again. The sorted array holds exactly the values
+	    the general filter loop sorts, so the results are identical. */
+	nvalmax = (2 * ndx + 1) * (2 * ndl + 1);
+	status = mb_mallocd(verbose,__FILE__,__LINE__,nvalmax*sizeof(double),
+				(void **)&val,error);
+
+	/* loop over all the data */
+	for (j=0;j<ndata && status == MB_SUCCESS;j++)
+		{
+		/* get beginning and end pings */
+		ja = j - ndl;
+		jb = j + ndl;
+		if (ja < 0) ja = 0;
+		if (jb >= ndata) jb = ndata - 1;
+
+		/* start with an empty window */
+		nval = 0;
+		wa = 0;
+		wb = -1;
+
+		/* loop over each value */
+		for (i=0;i<ping[j].ndatapts;i++)
+			{
+			/* get beginning and end values */
+			ia = i - ndx;
+			ib = i + ndx;
+			if (ia < 0) ia = 0;
+			if (ib >= ping[j].ndatapts) ib = ping[j].ndatapts - 1;
+
+			/* remove columns leaving the window */
+			while (wa < ia)
+				{
+				for (jj=ja;jj<=jb;jj++)
+					{
+					if (mb_beam_ok(ping[jj].flag_ptr[wa]))
+						{
+						value = ping[jj].data_i_ptr[wa];
+						lo = 0;
+						hi = nval;
+						while (lo < hi)
+							{
+							mid = (lo + hi) / 2;
+							if (val[mid] < value)
+								lo = mid + 1;
+							else
+								hi = mid;
+							}
+						if (lo < nval && val[lo] == value)
+							{
+							memmove(&val[lo], &val[lo+1],
+								(nval - lo - 1) * sizeof(double));
+							nval--;
+							}
+						}
+					}
+				wa++;
+				}
+
+			/* add columns entering the window */
+			while (wb < ib)
+				{
+				wb++;
+				for (jj=ja;jj<=jb;jj++)
+					{
+					if (mb_beam_ok(ping[jj].flag_ptr[wb]))
+						{
+						value = ping[jj].data_i_ptr[wb];
+						lo = 0;
+						hi = nval;
+						while (lo < hi)
+							{
+							mid = (lo + hi) / 2;
+							if (val[mid] > value)
+								hi = mid;
+							else
+								lo = mid + 1;
+							}
+						memmove(&val[lo+1], &val[lo],
+							(nval - lo) * sizeof(double));
+						val[lo] = value;
+						nval++;
+						}
+					}
+				}
+
+			/* only filter valid values */
+			if (!mb_beam_ok(ping[j].flag_ptr[i]) || nval <= 0)
+				{
+				ping[j].data_f_ptr[i] = MB_SIDESCAN_NULL;
+				}
+
+			/* the hipass median has always been taken relative to
+				the smallest value in the sorted window */
+			else if (filter->mode == MBFILTER_A_HIPASS_MEDIAN)
+				{
+				ping[j].data_f_ptr[i] = val[0] - val[nval/2];
+				}
+
+			/* get median and apply thresholding */
+			else
+				{
+				ping[j].data_f_ptr[i] = val[nval/2];
+				if (filter->threshold == MB_YES)
+					{
+					ratio = ping[j].data_i_ptr[i] / val[nval/2];
+					if (ratio < filter->threshold_hi
+						&& ratio > filter->threshold_lo)
+						ping[j].data_f_ptr[i] = ping[j].data_i_ptr[i];
+					}
+				}
+			}
+		}
+
+	/* deallocate array */
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&val,error);
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBFILTER function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 int hipass_mean(int verbose, int n, double *val, double *wgt,
 		double *hipass, int *error)
 {
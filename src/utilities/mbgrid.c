@@ -129,6 +129,9 @@ int mbgrid_weight(int verbose, double foot_a, double foot_b,
 		    double pcx, double pcy, double dx, double dy,
 		    double *px, double *py,
 		    double *weight, int *use, int *error);
+int mbgrid_proj_forward(int verbose, void *pjptr, int npoint,
+		    char *beamflag, double *ss,
+		    double *lon, double *lat, int *error);
 
 /* output stream for basic stuff (stdout if verbose <= 1,
 	stderr if verbose > 1) */
@@ -1785,12 +1788,10 @@ gbnd[0], gbnd[1], gbnd[2], gbnd[3]);*/
 					    navlon, navlat,
 					    &navlon, &navlat,
 					    &error);
-			    for (ib=0;ib<beams_bath;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_bath,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -2219,12 +2220,10 @@ status = write_cdfgrd(verbose,ofile,output,sxdim,sydim,
 					    navlon, navlat,
 					    &navlon, &navlat,
 					    &error);
-			    for (ib=0;ib<beams_bath;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_bath,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -2743,12 +2742,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], navlon, navlat);*/
 					    navlon, navlat,
 					    &navlon, &navlat,
 					    &error);
-			    for (ib=0;ib<beams_bath;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_bath,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -3240,12 +3237,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], navlon, navlat);*/
 			  /* reproject beam positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<beams_bath;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_bath,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -3365,12 +3360,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], dx, dy, wbnd[0], wbnd[1]); */
 			  /* reproject beam positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<beams_amp;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_amp,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -3485,12 +3478,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], dx, dy, wbnd[0], wbnd[1]); */
 			  /* reproject pixel positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<pixels_ss;ib++)
-			      if (ss[ib] > MB_SIDESCAN_NULL)
-				mb_proj_forward(verbose, pjptr,
-						sslon[ib], sslat[ib],
-						&sslon[ib], &sslat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, pixels_ss,
+			    		NULL, ss,
+			    		sslon, sslat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -3971,12 +3962,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], dx, dy, wbnd[0], wbnd[1]); */
 			  /* reproject beam positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<beams_bath;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_bath,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -4060,12 +4049,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], dx, dy, wbnd[0], wbnd[1]); */
 			  /* reproject beam positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<beams_amp;ib++)
-			      if (mb_beam_ok(beamflag[ib]))
-				mb_proj_forward(verbose, pjptr,
-						bathlon[ib], bathlat[ib],
-						&bathlon[ib], &bathlat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, beams_amp,
+			    		beamflag, NULL,
+			    		bathlon, bathlat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -4149,12 +4136,10 @@ ib, ix, iy, bathlon[ib], bathlat[ib], bath[ib], dx, dy, wbnd[0], wbnd[1]); */
 			  /* reproject pixel positions if necessary */
 			  if (use_projection == MB_YES)
 			    {
-			    for (ib=0;ib<pixels_ss;ib++)
-			      if (ss[ib] > MB_SIDESCAN_NULL)
-				mb_proj_forward(verbose, pjptr,
-						sslon[ib], sslat[ib],
-						&sslon[ib], &sslat[ib],
-						&error);
+			    mbgrid_proj_forward(verbose, pjptr, pixels_ss,
+			    		NULL, ss,
+			    		sslon, sslat,
+			    		&error);
 			    }
 
 			  /* deal with data */
@@ -5744,6 +5729,68 @@ int mbgrid_weight(int verbose, double foot_a, double foot_b,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+/* forward project the valid beams (beamflag != NULL) or sidescan
+	pixels (ss != NULL) of a ping in place - each contiguous run of
+	valid positions is projected with one call so that flagged beams
+	and null pixels are left untouched */
+int mbgrid_proj_forward(int verbose, void *pjptr, int npoint,
+		    char *beamflag, double *ss,
+		    double *lon, double *lat, int *error)
+{
+	char	*function_name = "mbgrid_proj_forward";
+	int	status = MB_SUCCESS;
+	int	istart;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(outfp,"\ndbg2  Function <%s> called\n",
+			function_name);
+		fprintf(outfp,"dbg2  Input arguments:\n");
+		fprintf(outfp,"dbg2       verbose:     %d\n",verbose);
+		fprintf(outfp,"dbg2       pjptr:       %p\n",(void *)pjptr);
+		fprintf(outfp,"dbg2       npoint:      %d\n",npoint);
+		fprintf(outfp,"dbg2       beamflag:    %p\n",(void *)beamflag);
+		fprintf(outfp,"dbg2       ss:          %p\n",(void *)ss);
+		}
+
+	/* project each run of valid positions in place */
+	istart = -1;
+	for (i=0;i<=npoint;i++)
+		{
+		if (i < npoint
+			&& ((beamflag != NULL && mb_beam_ok(beamflag[i]))
+				|| (beamflag == NULL && ss[i] > MB_SIDESCAN_NULL)))
+			{
+			if (istart < 0)
+				istart = i;
+			}
+		else if (istart >= 0)
+			{
+			status = mb_proj_forward_array(verbose, pjptr, i - istart,
+					&lon[istart], &lat[istart],
+					&lon[istart], &lat[istart],
+					error);
+			istart = -1;
+			}
+		}
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(outfp,"\ndbg2  MBIO function <%s> completed\n",
+			function_name);
+		fprintf(outfp,"dbg2  Return values:\n");
+		fprintf(outfp,"dbg2       error:       %d\n",*error);
+		fprintf(outfp,"dbg2  Return status:\n");
+		fprintf(outfp,"dbg2       status:      %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
 /* approximate complementary error function from numerical recipies */
 double erfcc(double x)
 {
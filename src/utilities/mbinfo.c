@@ -53,6 +53,31 @@ struct ping
 	double	*sslat;
 	};
 
+/* coverage mask accumulation - coverage is accumulated on a fine raster
+	that doubles its cell size whenever data fall outside it, and is
+	reduced to the requested mask dimensions once the bounds are known -
+	the raster has MBINFO_COVERAGE_FACTOR cells for each requested mask
+	cell, within the MBINFO_COVERAGE_DIMMIN to MBINFO_COVERAGE_DIMMAX
+	limits */
+#define MBINFO_COVERAGE_DIMMIN	1024
+#define MBINFO_COVERAGE_DIMMAX	8192
+#define MBINFO_COVERAGE_FACTOR	8
+#define MBINFO_COVERAGE_DXMIN	0.000001
+struct mbinfo_coverage
+	{
+	int	init;
+	int	dim;
+	double	xmin;
+	double	ymin;
+	double	dx;
+	double	dy;
+	char	*cells;
+	};
+static void mbinfo_coverage_add(struct mbinfo_coverage *coverage, double x, double y);
+static void mbinfo_coverage_mask(struct mbinfo_coverage *coverage,
+			double lonmin, double latmin, double mask_dx, double mask_dy,
+			int mask_nx, int mask_ny, int *mask);
+
 /* output formats */
 #define FREE_TEXT 	0
 #define JSON 		1
@@ -279,13 +304,12 @@ int main (int argc, char **argv)
 
 	/* coverage mask variables */
 	int	coverage_mask = MB_NO;
-	int	pass;
-	int	done;
 	int	mask_nx = 0;
 	int	mask_ny = 0;
 	double	mask_dx = 0.0;
 	double	mask_dy = 0.0;
 	int	*mask = NULL;
+	struct mbinfo_coverage coverage;
 
 	/* notice variables */
 	int	print_notices = MB_NO;
@@ -310,7 +334,6 @@ int main (int argc, char **argv)
 	double	time_d_last = 0.0;
 	int	val_int;
 	double	val_double;
-	int	ix, iy;
 	int	i, j, k;
 	double	sigma;
 
@@ -583,11 +606,27 @@ int main (int argc, char **argv)
 		case '?':
 			break;
 		}
-	/* read only once unless coverage mask requested */
-	pass = 0;
-	done = MB_NO;
-	while (done == MB_NO)
-	{
+	/* initialize coverage accumulation */
+	coverage.init = MB_NO;
+	coverage.dim = MBINFO_COVERAGE_DIMMIN;
+	coverage.cells = NULL;
+	if (coverage_mask == MB_YES)
+		{
+		coverage.dim = MAX(coverage.dim, MBINFO_COVERAGE_FACTOR * MAX(mask_nx, mask_ny));
+		coverage.dim = MIN(coverage.dim, MBINFO_COVERAGE_DIMMAX);
+		status = mb_mallocd(verbose,__FILE__,__LINE__,coverage.dim*coverage.dim,
+				(void **)&coverage.cells,&error);
+		if (error != MB_ERROR_NO_ERROR)
+			{
+			mb_error(verbose,error,&message);
+			fprintf(stream,"\nMBIO Error allocating data arrays:\n%s\n",message);
+			fprintf(stream,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		memset(coverage.cells, 0, coverage.dim*coverage.dim);
+		}
+
 	/* open file list */
 	if (read_datalist == MB_YES)
 	    {
@@ -680,7 +719,7 @@ int main (int argc, char **argv)
 			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_SIDESCAN,
 							sizeof(double), (void **)&datacur->sslat, &error);
 		}
-	if (pings_read > 1 && pass == 0)
+	if (pings_read > 1)
 		{
 		if (error == MB_ERROR_NO_ERROR)
 			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_BATHYMETRY,
@@ -711,35 +750,6 @@ int main (int argc, char **argv)
 							sizeof(int), (void **)&nssvar, &error);
 		}
 
-	/* if coverage mask requested get cell sizes */
-	if (pass == 1 && coverage_mask == MB_YES)
-	    {
-	    if (mask_nx > 1 && mask_ny <= 0)
-		{
-		if ((lonmax - lonmin) > (latmax - latmin))
-		    {
-		    mask_ny = mask_nx * (latmax - latmin) / (lonmax - lonmin);
-		    }
-		else
-		    {
-		    mask_ny = mask_nx;
-		    mask_nx = mask_ny * (lonmax - lonmin) / (latmax - latmin);
-		    if (mask_ny < 2)
-			mask_ny = 2;
-		    }
-		}
-	    if (mask_nx < 2)
-		mask_nx = 2;
-	    if (mask_ny < 2)
-		mask_ny = 2;
-	    mask_dx = (lonmax - lonmin) / mask_nx;
-	    mask_dy = (latmax - latmin) / mask_ny;
-
-	    /* allocate mask */
-	    status = mb_mallocd(verbose,__FILE__,__LINE__,mask_nx*mask_ny*sizeof(int),
-				(void **)&mask,&error);
-	    }
-
 	/* if error initializing memory then quit */
 	if (error != MB_ERROR_NO_ERROR)
 		{
@@ -755,7 +765,7 @@ int main (int argc, char **argv)
 	distotfile = 0.0;
 	timtotfile = 0.0;
 	spdavgfile = 0.0;
-	if (pass == 0 && pings_read > 1)
+	if (pings_read > 1)
 		{
 		for (i=0;i<beams_bath_alloc;i++)
 			{
@@ -776,11 +786,6 @@ int main (int argc, char **argv)
 			nssvar[i] = 0;
 			}
 		}
-	if (pass == 1 && coverage_mask == MB_YES)
-		{
-		for (i=0;i<mask_nx*mask_ny;i++)
-		    mask[i] = MB_NO;
-		}
 
 	/* initialize metadata counters */
 	meta_vessel = 0;
@@ -803,67 +808,64 @@ int main (int argc, char **argv)
 	meta_draft = 0;
 
 	/* printf out file and format */
-	if (pass == 0)
+	if (strrchr(file, '/') == NULL)
+	    fileprint = file;
+	else
+	    fileprint = strrchr(file, '/') + 1;
+	mb_format_description(verbose,&format,format_description,&error);
+	switch (output_format)
 		{
-		if (strrchr(file, '/') == NULL)
-		    fileprint = file;
-		else
-		    fileprint = strrchr(file, '/') + 1;
-		mb_format_description(verbose,&format,format_description,&error);
-		switch (output_format)
-			{
-			case FREE_TEXT:
-				fprintf(output,"\nSwath Data File:      %s\n",fileprint);
-				fprintf(output,"MBIO Data Format ID:  %d\n",format);
-				fprintf(output,"%s",format_description);
-				break;
-			case JSON:
-				fprintf(output,"\"file_info\":{\n");
-				fprintf(output,"\"swath_data_file\":\"%s\",\n",fileprint);
-				fprintf(output,"\"mbio_data_format_id\":\"%d\",\n",format);
-				len1=strspn(format_description,"Formatname: ");
-				len2=strcspn(&format_description[len1],"\n");
-				strncpy(string,&format_description[len1],len2);
-				fprintf(output,"\"format_name\": \"%s\",\n",string);
-				len1+=len2+1;
-				len1+=strspn(&format_description[len1],"InformalDescription: ");
-				len2=strcspn(&format_description[len1],"\n");
-				strncpy(string,&format_description[len1],len2);
-				fprintf(output,"\"informal_description\": \"%s\",\n",string);
-				len1+=len2+1;
-				len1+=strspn(&format_description[len1],"Attributes: ");
-				len2=strlen(format_description);
-				format_description[strlen(format_description)-1]='\0';
-				for (len2=len1;len2<=strlen(format_description);len2++)
-					if (format_description[len2]==10)format_description[len2]=';';
-				fprintf(output,"\"attributes\": \"%s\"\n",&format_description[len1]);
-				fprintf(output,"},\n");
-				break;
-			case XML:
-				fprintf(output,"\t<file_info>\n");
-				fprintf(output,"\t\t<swath_data_file>%s</swath_data_file>\n",fileprint);
-				fprintf(output,"\t\t<mbio_data_format_id>%d</mbio_data_format_id>\n",format);
-				len1=strspn(format_description,"Formatname: ");
-				len2=strcspn(&format_description[len1],"\n");
-				strncpy(string,&format_description[len1],len2);
-				fprintf(output,"\t\t<format_name>%s</format_name>\n",string);
-				len1+=len2+1;
-				len1+=strspn(&format_description[len1],"InformalDescription: ");
-				len2=strcspn(&format_description[len1],"\n");
-				strncpy(string,&format_description[len1],len2);
-				fprintf(output,"\t\t<informal_description>%s</informal_description>\n",string);
-				len1+=len2+1;
-				len1+=strspn(&format_description[len1],"Attributes: ");
-				len2=strlen(format_description);
-				format_description[strlen(format_description)-1]='\0';
-				for (len2=len1;len2<=strlen(format_description);len2++)
-					if (format_description[len2]==10)format_description[len2]=' ';
-				fprintf(output,"\t\t<attributes>%s</attributes>\n",&format_description[len1]);
-				fprintf(output,"\t</file_info>\n");
-				break;
-			case '?':
-				errflg++;
-			}
+		case FREE_TEXT:
+			fprintf(output,"\nSwath Data File:      %s\n",fileprint);
+			fprintf(output,"MBIO Data Format ID:  %d\n",format);
+			fprintf(output,"%s",format_description);
+			break;
+		case JSON:
+			fprintf(output,"\"file_info\":{\n");
+			fprintf(output,"\"swath_data_file\":\"%s\",\n",fileprint);
+			fprintf(output,"\"mbio_data_format_id\":\"%d\",\n",format);
+			len1=strspn(format_description,"Formatname: ");
+			len2=strcspn(&format_description[len1],"\n");
+			strncpy(string,&format_description[len1],len2);
+			fprintf(output,"\"format_name\": \"%s\",\n",string);
+			len1+=len2+1;
+			len1+=strspn(&format_description[len1],"InformalDescription: ");
+			len2=strcspn(&format_description[len1],"\n");
+			strncpy(string,&format_description[len1],len2);
+			fprintf(output,"\"informal_description\": \"%s\",\n",string);
+			len1+=len2+1;
+			len1+=strspn(&format_description[len1],"Attributes: ");
+			len2=strlen(format_description);
+			format_description[strlen(format_description)-1]='\0';
+			for (len2=len1;len2<=strlen(format_description);len2++)
+				if (format_description[len2]==10)format_description[len2]=';';
+			fprintf(output,"\"attributes\": \"%s\"\n",&format_description[len1]);
+			fprintf(output,"},\n");
+			break;
+		case XML:
+			fprintf(output,"\t<file_info>\n");
+			fprintf(output,"\t\t<swath_data_file>%s</swath_data_file>\n",fileprint);
+			fprintf(output,"\t\t<mbio_data_format_id>%d</mbio_data_format_id>\n",format);
+			len1=strspn(format_description,"Formatname: ");
+			len2=strcspn(&format_description[len1],"\n");
+			strncpy(string,&format_description[len1],len2);
+			fprintf(output,"\t\t<format_name>%s</format_name>\n",string);
+			len1+=len2+1;
+			len1+=strspn(&format_description[len1],"InformalDescription: ");
+			len2=strcspn(&format_description[len1],"\n");
+			strncpy(string,&format_description[len1],len2);
+			fprintf(output,"\t\t<informal_description>%s</informal_description>\n",string);
+			len1+=len2+1;
+			len1+=strspn(&format_description[len1],"Attributes: ");
+			len2=strlen(format_description);
+			format_description[strlen(format_description)-1]='\0';
+			for (len2=len1;len2<=strlen(format_description);len2++)
+				if (format_description[len2]==10)format_description[len2]=' ';
+			fprintf(output,"\t\t<attributes>%s</attributes>\n",&format_description[len1]);
+			fprintf(output,"\t</file_info>\n");
+			break;
+		case '?':
+			errflg++;
 		}
 
 	/* read and process data */
@@ -900,9 +902,8 @@ int main (int argc, char **argv)
 			sslat = datacur->sslat;
 
 			/* increment counters */
-			if (pass == 0
-				&& (error == MB_ERROR_NO_ERROR
-				    || error == MB_ERROR_TIME_GAP))
+			if (error == MB_ERROR_NO_ERROR
+				    || error == MB_ERROR_TIME_GAP)
 				{
 				irec++;
 				irecfile++;
@@ -910,8 +911,7 @@ int main (int argc, char **argv)
 				}
 
 			/* print comment records */
-			if (pass == 0
-				&& error == MB_ERROR_COMMENT
+			if (error == MB_ERROR_COMMENT
 				&& comments == MB_YES)
 				{
 				if (strncmp(comment,"META",4) != 0)
@@ -946,8 +946,7 @@ int main (int argc, char **argv)
 				}
 
 			/* print metadata */
-			if (pass == 0
-				&& error == MB_ERROR_COMMENT
+			if (error == MB_ERROR_COMMENT
 				&& strncmp(comment,"META",4) == 0)
 				{
 					switch (output_format)
@@ -1406,7 +1405,7 @@ int main (int argc, char **argv)
 					}
 
 			/* output error messages */
-			if (pass != 0 || error == MB_ERROR_COMMENT)
+			if (error == MB_ERROR_COMMENT)
 				{
 				/* do nothing */
 				}
@@ -1448,9 +1447,8 @@ int main (int argc, char **argv)
 			beams_bath_max = MAX(beams_bath_max, beams_bath);
 			beams_amp_max = MAX(beams_amp_max, beams_amp);
 			pixels_ss_max = MAX(pixels_ss_max, pixels_ss);
-			if (pass == 0
-				&& (error == MB_ERROR_NO_ERROR
-				    || error == MB_ERROR_TIME_GAP))
+			if (error == MB_ERROR_NO_ERROR
+				    || error == MB_ERROR_TIME_GAP)
 				{
 				/* update data counts */
 				ntdbeams += beams_bath;
@@ -1755,49 +1753,26 @@ int main (int argc, char **argv)
 				}
 
 			/* update coverage mask */
-			if (pass == 1 && coverage_mask == MB_YES
+			if (coverage_mask == MB_YES && good_nav == MB_YES
 				&& (error == MB_ERROR_NO_ERROR
 				    || error == MB_ERROR_TIME_GAP))
 			    {
-			    ix = (int)((navlon - lonmin) / mask_dx);
-			    iy = (int)((navlat - latmin) / mask_dy);
-			    if (ix >= 0 && ix < mask_nx
-				&& iy >= 0 && iy < mask_ny)
-				{
-				mask[ix+iy*mask_nx] = MB_YES;
-				}
+			    mbinfo_coverage_add(&coverage, navlon, navlat);
 			    for (i=0;i<beams_bath;i++)
 				{
 				if (mb_beam_ok(beamflag[i]))
-				    {
-				    ix = (int)((bathlon[i] - lonmin) / mask_dx);
-				    iy = (int)((bathlat[i] - latmin) / mask_dy);
-				    if (ix >= 0 && ix < mask_nx
-					&& iy >= 0 && iy < mask_ny)
-					{
-					mask[ix+iy*mask_nx] = MB_YES;
-					}
-				    }
+				    mbinfo_coverage_add(&coverage, bathlon[i], bathlat[i]);
 				}
 			    for (i=0;i<pixels_ss;i++)
 				{
 				if (ss[i] > MB_SIDESCAN_NULL)
-				    {
-				    ix = (int)((sslon[i] - lonmin) / mask_dx);
-				    iy = (int)((sslat[i] - latmin) / mask_dy);
-				    if (ix >= 0 && ix < mask_nx
-					&& iy >= 0 && iy < mask_ny)
-					{
-					mask[ix+iy*mask_nx] = MB_YES;
-					}
-				    }
+				    mbinfo_coverage_add(&coverage, sslon[i], sslat[i]);
 				}
 			    }
 
 			/* look for problems */
-			if (pass == 0
-				&& (error == MB_ERROR_NO_ERROR
-				    || error == MB_ERROR_TIME_GAP))
+			if (error == MB_ERROR_NO_ERROR
+				    || error == MB_ERROR_TIME_GAP)
 			    {
 			    if (navlon == 0.0 || navlat == 0.0)
 				mb_notice_log_problem(verbose, mbio_ptr, MB_PROBLEM_ZERO_NAV);
@@ -1828,8 +1803,7 @@ int main (int argc, char **argv)
 			}
 
 		/* process the pings */
-		if (pass == 0
-			&& pings_read > 2
+		if (pings_read > 2
 			&& nread == pings_read
 			&& (error == MB_ERROR_NO_ERROR
 			|| error == MB_ERROR_TIME_GAP))
@@ -1980,7 +1954,7 @@ int main (int argc, char **argv)
 		mb_notice_log_problem(verbose, mbio_ptr, MB_PROBLEM_AVG_TOO_FAST);
 
 	/* get notices if desired */
-	if (print_notices == MB_YES && pass == 0)
+	if (print_notices == MB_YES)
 		{
 		status = mb_notice_get_list(verbose, mbio_ptr,
 					    notice_list);
@@ -2118,13 +2092,45 @@ int main (int argc, char **argv)
 	if (read_datalist == MB_YES)
 		mb_datalist_close(verbose,&datalist,&error);
 
-	/* figure out if done */
-	if (pass > 0 || coverage_mask == MB_NO)
-	    done = MB_YES;
-	pass++;
+	/* if coverage mask requested get cell sizes and reduce the
+		accumulated coverage to the mask */
+	if (coverage_mask == MB_YES)
+	    {
+	    if (mask_nx > 1 && mask_ny <= 0)
+		{
+		if ((lonmax - lonmin) > (latmax - latmin))
+		    {
+		    mask_ny = mask_nx * (latmax - latmin) / (lonmax - lonmin);
+		    }
+		else
+		    {
+		    mask_ny = mask_nx;
+		    mask_nx = mask_ny * (lonmax - lonmin) / (latmax - latmin);
+		    if (mask_ny < 2)
+			mask_ny = 2;
+		    }
+		}
+	    if (mask_nx < 2)
+		mask_nx = 2;
+	    if (mask_ny < 2)
+		mask_ny = 2;
+	    mask_dx = (lonmax - lonmin) / mask_nx;
+	    mask_dy = (latmax - latmin) / mask_ny;
 
-	/* end loop over reading passes */
-	}
+	    /* allocate mask */
+	    status = mb_mallocd(verbose,__FILE__,__LINE__,mask_nx*mask_ny*sizeof(int),
+				(void **)&mask,&error);
+	    if (error != MB_ERROR_NO_ERROR)
+		{
+		mb_error(verbose,error,&message);
+		fprintf(stream,"\nMBIO Error allocating data arrays:\n%s\n",message);
+		fprintf(stream,"\nProgram <%s> Terminated\n",
+			program_name);
+		exit(error);
+		}
+	    mbinfo_coverage_mask(&coverage, lonmin, latmin, mask_dx, mask_dy,
+				mask_nx, mask_ny, mask);
+	    }
 
 	/* calculate final variances */
 	if (pings_read > 2)
@@ -2875,6 +2881,7 @@ int main (int argc, char **argv)
 	mb_freed(verbose,__FILE__,__LINE__,(void **)&ssvartot,&error);
 	mb_freed(verbose,__FILE__,__LINE__,(void **)&nssvartot,&error);
 	mb_freed(verbose,__FILE__,__LINE__,(void **)&mask,&error);
+	mb_freed(verbose,__FILE__,__LINE__,(void **)&coverage.cells,&error);
 
 	/* set program status */
 	status = MB_SUCCESS;
@@ -2896,3 +2903,157 @@ int main (int argc, char **argv)
 	exit(error);
 }
 /*--------------------------------------------------------------------*/
+/*
+ * Adds the point (x, y) to the fine coverage raster. The raster is centered
+ * on the first point at the finest resolution, and whenever a point falls
+ * outside it the cell size in that direction is doubled, merging pairs of
+ * cells, with the raster extended toward the point.
+ */
+static void mbinfo_coverage_add(struct mbinfo_coverage *coverage, double x, double y)
+{
+	char	*cells;
+	int	dim;
+	int	offset;
+	int	i, j, ii, jj;
+
+	if (isnan(x) || isnan(y) || isinf(x) || isinf(y))
+		return;
+	cells = coverage->cells;
+	dim = coverage->dim;
+	if (coverage->init == MB_NO)
+		{
+		coverage->dx = MBINFO_COVERAGE_DXMIN;
+		coverage->dy = MBINFO_COVERAGE_DXMIN;
+		coverage->xmin = x - 0.5 * dim * coverage->dx;
+		coverage->ymin = y - 0.5 * dim * coverage->dy;
+		coverage->init = MB_YES;
+		}
+
+	/* coarsen in x until the point lies within the raster */
+	while (x < coverage->xmin || x >= coverage->xmin + dim * coverage->dx)
+		{
+		if (x < coverage->xmin)
+			{
+			offset = dim;
+			coverage->xmin -= dim * coverage->dx;
+			}
+		else
+			offset = 0;
+		for (j=0;j<dim;j++)
+			{
+			if (offset == 0)
+				{
+				for (i=0;i<dim;i++)
+					{
+					ii = 2 * i;
+					if (ii < dim)
+						cells[i+j*dim] = cells[ii+j*dim]
+									| cells[ii+1+j*dim];
+					else
+						cells[i+j*dim] = 0;
+					}
+				}
+			else
+				{
+				for (i=dim-1;i>=0;i--)
+					{
+					ii = 2 * i - offset;
+					if (ii >= 0)
+						cells[i+j*dim] = cells[ii+j*dim]
+									| cells[ii+1+j*dim];
+					else
+						cells[i+j*dim] = 0;
+					}
+				}
+			}
+		coverage->dx *= 2.0;
+		}
+
+	/* coarsen in y until the point lies within the raster */
+	while (y < coverage->ymin || y >= coverage->ymin + dim * coverage->dy)
+		{
+		if (y < coverage->ymin)
+			{
+			offset = dim;
+			coverage->ymin -= dim * coverage->dy;
+			}
+		else
+			offset = 0;
+		if (offset == 0)
+			{
+			for (j=0;j<dim;j++)
+				{
+				jj = 2 * j;
+				for (i=0;i<dim;i++)
+					{
+					if (jj < dim)
+						cells[i+j*dim] = cells[i+jj*dim]
+									| cells[i+(jj+1)*dim];
+					else
+						cells[i+j*dim] = 0;
+					}
+				}
+			}
+		else
+			{
+			for (j=dim-1;j>=0;j--)
+				{
+				jj = 2 * j - offset;
+				for (i=0;i<dim;i++)
+					{
+					if (jj >= 0)
+						cells[i+j*dim] = cells[i+jj*dim]
+									| cells[i+(jj+1)*dim];
+					else
+						cells[i+j*dim] = 0;
+					}
+				}
+			}
+		coverage->dy *= 2.0;
+		}
+
+	/* set the cell containing the point */
+	i = (int)((x - coverage->xmin) / coverage->dx);
+	j = (int)((y - coverage->ymin) / coverage->dy);
+	if (i >= 0 && i < dim && j >= 0 && j < dim)
+		cells[i+j*dim] = 1;
+}
+/*--------------------------------------------------------------------*/
+/*
+ * Sets each mask cell that overlaps an occupied cell of the fine coverage raster.
+ */
+static void mbinfo_coverage_mask(struct mbinfo_coverage *coverage,
+			double lonmin, double latmin, double mask_dx, double mask_dy,
+			int mask_nx, int mask_ny, int *mask)
+{
+	double	x0, x1, y0, y1;
+	int	dim;
+	int	ix0, ix1, iy0, iy1;
+	int	i, j, ix, iy;
+
+	for (i=0;i<mask_nx*mask_ny;i++)
+		mask[i] = MB_NO;
+	if (coverage->init == MB_NO || mask_dx <= 0.0 || mask_dy <= 0.0)
+		return;
+
+	dim = coverage->dim;
+	for (j=0;j<dim;j++)
+	for (i=0;i<dim;i++)
+		{
+		if (coverage->cells[i+j*dim] != 0)
+			{
+			x0 = (coverage->xmin + i * coverage->dx - lonmin) / mask_dx;
+			x1 = (coverage->xmin + (i + 1) * coverage->dx - lonmin) / mask_dx;
+			y0 = (coverage->ymin + j * coverage->dy - latmin) / mask_dy;
+			y1 = (coverage->ymin + (j + 1) * coverage->dy - latmin) / mask_dy;
+			ix0 = MAX((int)floor(x0), 0);
+			ix1 = MIN((int)ceil(x1) - 1, mask_nx - 1);
+			iy0 = MAX((int)floor(y0), 0);
+			iy1 = MIN((int)ceil(y1) - 1, mask_ny - 1);
+			for (ix=ix0;ix<=ix1;ix++)
+			for (iy=iy0;iy<=iy1;iy++)
+				mask[ix+iy*mask_nx] = MB_YES;
+			}
+		}
+}
+/*--------------------------------------------------------------------*/
@@ -721,6 +721,12 @@ int main (int argc, char **argv)
 	istore_ptr = imb_io_ptr->store_data;
 	istore = (struct mbsys_simrad3_struct *) istore_ptr;
 
+	/* only ancillary data are needed in this pass, so unless the
+		record counts are to be reported skip the raw beam, sidescan
+		and water column datagrams */
+	if (output_counts == MB_NO)
+		imb_io_ptr->scan_ancillary = MB_YES;
+
 	if (error == MB_ERROR_NO_ERROR)
 		{
 		beamflag = NULL;
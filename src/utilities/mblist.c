@@ -61,6 +61,8 @@
 #define	MBLIST_SET_ON	1
 #define	MBLIST_SET_ALL	2
 #define MBLIST_SET_EXCLUDE_OUTER 3
+#define	MBLIST_OUTPUT_BUFFER	1048576
+#define	MBLIST_FIXED_PRECISION_MAX	9
 
 /* function prototypes */
 int set_output(	int	verbose,
@@ -97,6 +99,7 @@ int printsimplevalue(int verbose, FILE *output,
 		double value, int width, int precision,
 		int ascii, int *invert, int *flipsign, int *error);
 int printNaN(int verbose, FILE *output, int ascii, int *invert, int *flipsign, int *error);
+int format_fixed(char *string, double value, int width, int precision);
 int mb_get_raw(int verbose, void *mbio_ptr,
 		int *mode,
 		int *ipulse_length,
@@ -376,6 +379,7 @@ int main (int argc, char **argv)
 	/* output files */
 	FILE	**output;
 	FILE	*outfile;
+	char	*outfile_buffer = NULL;
 	char	output_file[MB_PATH_MAXLINE];
 	char	output_file_temp[MB_PATH_MAXLINE];
 	char	buffer[MB_BUFFER_MAX];
@@ -729,6 +733,13 @@ int main (int argc, char **argv)
 		exit(1);
 	      }
 
+	    /* use a large output buffer - mblist writes many small
+		values and is often used to dump entire surveys */
+	    status = mb_mallocd(verbose, __FILE__, __LINE__, MBLIST_OUTPUT_BUFFER,
+			(void **)&outfile_buffer, &error);
+	    if (status == MB_SUCCESS)
+	      setvbuf(outfile, outfile_buffer, _IOFBF, MBLIST_OUTPUT_BUFFER);
+
 	    /* for non netcdf all output goes to the same file */
 	    for ( i=0; i < n_list; i++)
 	      output[i] = outfile;
@@ -3503,7 +3514,7 @@ int main (int argc, char **argv)
 						if (netcdf == MB_YES)
 						  fprintf(output[i], ", ");
 						if (ascii == MB_YES)
-						  fprintf(output[i], "%s", delimiter);
+						  fputs(delimiter, output[i]);
 						invert_next_value = invert;
 						signflip_next_value = flip;
 
@@ -3516,7 +3527,7 @@ int main (int argc, char **argv)
 						if (netcdf == MB_YES)
 						  fprintf(output[i], ", ");
 						if (ascii == MB_YES)
-						  fprintf(output[i], "%s", delimiter);
+						  fputs(delimiter, output[i]);
 						printNaN(verbose, output[i], ascii, &invert_next_value,
 							 &signflip_next_value, &error);
 					      }
@@ -3587,7 +3598,7 @@ int main (int argc, char **argv)
 			    }
 			if (ascii == MB_YES)
 			    {
-			    if (i<(n_list-1)) fprintf(output[i], "%s", delimiter);
+			    if (i<(n_list-1)) fputs(delimiter, output[i]);
 			    else fprintf (output[lcount++ % n_list], "\n");
 			    }
 			}
@@ -4301,7 +4312,7 @@ int main (int argc, char **argv)
 						if (netcdf == MB_YES)
 						  fprintf(output[i], ", ");
 						if (ascii == MB_YES)
-						  fprintf(output[i], "%s", delimiter);
+						  fputs(delimiter, output[i]);
 						invert_next_value = invert;
 						signflip_next_value = flip;
 
@@ -4314,7 +4325,7 @@ int main (int argc, char **argv)
 						if (netcdf == MB_YES)
 						  fprintf(output[i], ", ");
 						if (ascii == MB_YES)
-						  fprintf(output[i], "%s", delimiter);
+						  fputs(delimiter, output[i]);
 						printNaN(verbose, output[i], ascii, &invert_next_value,
 							 &signflip_next_value, &error);
 					      }
@@ -4388,7 +4399,7 @@ int main (int argc, char **argv)
 			    }
 			if (ascii == MB_YES)
 			    {
-			    if (i<(n_list-1)) fprintf(output[i], "%s", delimiter);
+			    if (i<(n_list-1)) fputs(delimiter, output[i]);
 			    else fprintf (output[lcount++ % n_list], "\n");
 			    }
 			}
@@ -4475,6 +4486,8 @@ int main (int argc, char **argv)
 	else
 	    {
 	    fclose(outfile);
+	    if (outfile_buffer != NULL)
+	      mb_freed(verbose, __FILE__, __LINE__, (void **)&outfile_buffer, &error);
 	    }
 
 	/* check memory */
@@ -4912,7 +4925,9 @@ int printsimplevalue(int verbose, FILE *output,
 {
 	char	*function_name = "printsimplevalue";
 	int	status = MB_SUCCESS;
-	char	format[24];
+	char	string[64];
+	int	invert_value;
+	int	len;
 
 	/* print input debug statements */
 	if (verbose >= 2)
@@ -4929,16 +4944,8 @@ int printsimplevalue(int verbose, FILE *output,
 		fprintf(stderr,"dbg2       flipsign:        %d\n",*flipsign);
 		}
 
-	/* make print format */
-	format[0] = '%';
-	if (*invert == MB_YES)
-	    strcpy(format, "%g");
-	else if (width > 0)
-	    sprintf(&format[1], "%d.%df", width, precision);
-	else
-	    sprintf(&format[1], ".%df", precision);
-
 	/* invert value if desired */
+	invert_value = *invert;
 	if (*invert == MB_YES)
 	    {
 	    *invert = MB_NO;
@@ -4953,9 +4960,19 @@ int printsimplevalue(int verbose, FILE *output,
 	    value = -value;
 	    }
 
-	/* print value */
+	/* print value - inverted values use %g, others are fixed point
+		formatted directly when that is exact */
 	if (ascii == MB_YES)
-	    fprintf(output,format, value);
+	    {
+	    if (invert_value == MB_YES)
+		fprintf(output, "%g", value);
+	    else if ((len = format_fixed(string, value, width, precision)) > 0)
+		fwrite(string, 1, len, output);
+	    else if (width > 0)
+		fprintf(output, "%*.*f", width, precision, value);
+	    else
+		fprintf(output, "%.*f", precision, value);
+	    }
 	else
 	    fwrite(&value, sizeof(double), 1, output);
 
@@ -4975,6 +4992,69 @@ int printsimplevalue(int verbose, FILE *output,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+/*
+ * Formats value into string exactly as printf would with "%width.precisionf",
+ * without the cost of parsing a format. Returns the string length, or 0 if
+ * the value must be left to printf (non-finite or large values, high
+ * precision, or values too close to a rounding tie to decide here).
+ */
+int format_fixed(char *string, double value, int width, int precision)
+{
+	static double scale[MBLIST_FIXED_PRECISION_MAX+1] =
+		{ 1.0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9 };
+	char	digits[32];
+	double	scaled, whole, fraction;
+	unsigned long long rounded;
+	int	negative;
+	int	ndigits;
+	int	len;
+	int	i;
+
+	if (precision < 0 || precision > MBLIST_FIXED_PRECISION_MAX || width > 32
+		|| !(fabs(value) < 1.0e15 / scale[precision]))
+		return(0);
+
+	/* round to the requested precision, leaving ties and values
+		whose scaling error could change the rounding to printf */
+	negative = signbit(value);
+	scaled = fabs(value) * scale[precision];
+	whole = floor(scaled);
+	fraction = scaled - whole;
+	if (fabs(fraction - 0.5) <= 4.0e-16 * scaled)
+		return(0);
+	rounded = (unsigned long long) whole;
+	if (fraction > 0.5)
+		rounded++;
+
+	/* generate digits in reverse, with at least one before the point */
+	ndigits = 0;
+	do
+		{
+		digits[ndigits++] = '0' + (char)(rounded % 10);
+		rounded /= 10;
+		}
+	while (rounded > 0 || ndigits <= precision);
+
+	/* pad, sign, integer digits, point, fraction digits */
+	len = ndigits + (precision > 0 ? 1 : 0) + (negative ? 1 : 0);
+	i = 0;
+	while (i < width - len)
+		string[i++] = ' ';
+	if (negative)
+		string[i++] = '-';
+	while (ndigits > precision)
+		string[i++] = digits[--ndigits];
+	if (precision > 0)
+		{
+		string[i++] = '.';
+		while (ndigits > 0)
+			string[i++] = digits[--ndigits];
+		}
+	string[i] = '\0';
+
+	return(i);
+}
+/*--------------------------------------------------------------------*/
 int printNaN(int verbose, FILE *output, int ascii, int *invert, int *flipsign, int *error)
 {
 	char	*function_name = "printNaN";
@@ -5002,7 +5082,7 @@ int printNaN(int verbose, FILE *output, int ascii, int *invert, int *flipsign, i
 
 	/* print value */
 	if (ascii == MB_YES)
-	    fprintf(output,"NaN");
+	    fputs("NaN", output);
 	else
 	    fwrite(&NaN, sizeof(double), 1, output);
 
@@ -897,6 +897,10 @@ int main (int argc, char **argv)
 				program_name);
 			exit(error);
 			}
+
+		/* only ancillary data are needed in this pass, so let the
+			format skip the beam, sidescan and water column payloads */
+		((struct mb_io_struct *) imbio_ptr)->scan_ancillary = MB_YES;
 	
 		beamflag = NULL;
 		bath = NULL;
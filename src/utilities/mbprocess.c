@@ -93,6 +93,40 @@ struct mbprocess_grid_struct
 	float	*data;
 	};
 
+/* define structure holding a record read ahead while looking
+	for the first surface sound velocity */
+#define MBPROCESS_LOOKAHEAD_MAX		250
+#define MBPROCESS_LOOKAHEAD_MEMORY	33554432
+struct mbprocess_lookahead_struct
+	{
+	void	*store_ptr;
+	int	store_copy;
+	int	status;
+	int	error;
+	int	kind;
+	int	time_i[7];
+	double	time_d;
+	double	navlon;
+	double	navlat;
+	double	speed;
+	double	heading;
+	double	distance;
+	double	altitude;
+	double	sonardepth;
+	int	nbath;
+	int	namp;
+	int	nss;
+	char	*beamflag;
+	double	*bath;
+	double	*amp;
+	double	*bathacrosstrack;
+	double	*bathalongtrack;
+	double	*ss;
+	double	*ssacrosstrack;
+	double	*ssalongtrack;
+	char	comment[MB_COMMENT_MAXLINE];
+	};
+
 /* function prototypes */
 int check_ss_for_bath(int verbose,
 	int nbath, char *beamflag, double *bath, double *bathacrosstrack,
@@ -106,6 +140,9 @@ int get_corrtable(int verbose,
 int get_anglecorr(int verbose,
 	int nangle, double *angles, double *corrs,
 	double angle, double *corr, int *error);
+int mbprocess_free_lookahead(int verbose, void *mbio_ptr,
+	struct mbprocess_lookahead_struct *lookahead, int nlookahead,
+	int *error);
 
 static char rcs_id[] = "$Id$";
 
@@ -276,6 +313,9 @@ and mbedit edit save files.\n";
 	int	ntide = 0;
 	int	nstatic = 0;
 	int	size, nchar, len, nget, nav_ok, attitude_ok, sonardepth_ok, tide_ok, static_ok;
+	int	cached, cachekey, cacheinfo;
+	double	**cachecolumns[MBP_CACHE_NCOLUMN_MAX];
+	double	*cachevalues[MBP_CACHE_NCOLUMN_MAX];
 	int	time_j[5], stime_i[7], ftime_i[7];
 	int	ihr;
 	double	sec, hr;
@@ -373,6 +413,19 @@ and mbedit edit save files.\n";
 	int	ssv_prelimpass = MB_NO;
 	double	ssv_default;
 	double	ssv_start;
+	struct mbprocess_lookahead_struct *lookahead = NULL;
+	struct mbprocess_lookahead_struct *ahead;
+	int	lookahead_ok;
+	int	lookahead_error;
+	int	lookahead_format;
+	int	lookahead_system;
+	int	lookahead_nalloc;
+	int	lookahead_nallocmax;
+	int	lookahead_overflow;
+	size_t	lookahead_allocsize;
+	size_t	lookahead_allocstart;
+	int	nlookahead = 0;
+	int	ilookahead = 0;
 
 	/* sidescan correction */
 	double	altitude_default = 1000.0;
@@ -1583,22 +1636,77 @@ and mbedit edit save files.\n";
 	    else
 		    nchar = MBP_FILENAMESIZE-1;
 
+	    /* use the binary cache of an earlier parse of the nav file if it
+		is current - the parse depends on the nav format, lonflip and
+		which of the optional values are to be merged */
+	    cachekey = MBP_CACHE_KEY_NAV
+			+ process.mbp_nav_format + 100 * (lonflip + 1)
+			+ 1000 * (process.mbp_nav_heading == MBP_NAV_ON)
+			+ 2000 * (process.mbp_nav_speed == MBP_NAV_ON)
+			+ 4000 * (process.mbp_nav_draft == MBP_NAV_ON)
+			+ 8000 * (process.mbp_nav_attitude == MBP_NAV_ON);
+	    cachecolumns[0] = &ntime;
+	    cachecolumns[1] = &nlon;
+	    cachecolumns[2] = &nlat;
+	    cachecolumns[3] = &nheading;
+	    cachecolumns[4] = &nspeed;
+	    cachecolumns[5] = &ndraft;
+	    cachecolumns[6] = &nroll;
+	    cachecolumns[7] = &npitch;
+	    cachecolumns[8] = &nheave;
+	    if (mb_pr_readcache(verbose, process.mbp_navfile, cachekey,
+			9, &nnav, cachecolumns, &cacheinfo, &error) == MB_SUCCESS)
+		{
+		cached = MB_YES;
+		if ((cacheinfo & 1) == 0)
+			process.mbp_nav_heading = MBP_NAV_OFF;
+		if ((cacheinfo & 2) == 0)
+			process.mbp_nav_speed = MBP_NAV_OFF;
+		if ((cacheinfo & 4) == 0)
+			process.mbp_nav_draft = MBP_NAV_OFF;
+		if ((cacheinfo & 8) == 0)
+			process.mbp_nav_attitude = MBP_NAV_OFF;
+		}
+	    else
+		cached = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
 	    /* count the data points in the nav file */
-	    nnav = 0;
-	    if ((tfp = fopen(process.mbp_navfile, "r")) == NULL)
+	    if (cached == MB_NO)
+		{
+		nnav = 0;
+		if ((tfp = fopen(process.mbp_navfile, "r")) == NULL)
+			{
+			error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to Open Navigation File <%s> for reading\n",process.mbp_navfile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		while ((result = fgets(buffer,nchar,tfp)) == buffer)
+			nnav++;
+		fclose(tfp);
+		}
+
+	    /* allocate spline arrays for cached nav */
+	    if (cached == MB_YES)
+		{
+		status = mb_mallocd(verbose,__FILE__,__LINE__,nnav*sizeof(double),(void **)&nlonspl,&error);
+		status = mb_mallocd(verbose,__FILE__,__LINE__,nnav*sizeof(double),(void **)&nlatspl,&error);
+
+		/* if error initializing memory then quit */
+		if (error != MB_ERROR_NO_ERROR)
 		    {
-		    error = MB_ERROR_OPEN_FAIL;
-		    fprintf(stderr,"\nUnable to Open Navigation File <%s> for reading\n",process.mbp_navfile);
+		    mb_error(verbose,error,&message);
+		    fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",message);
 		    fprintf(stderr,"\nProgram <%s> Terminated\n",
 			    program_name);
 		    exit(error);
 		    }
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
-		    nnav++;
-	    fclose(tfp);
+		}
 
 	    /* allocate arrays for nav */
-	    if (nnav > 1)
+	    else if (nnav > 1)
 		{
 		size = (nnav+1)*sizeof(double);
 		status = mb_mallocd(verbose,__FILE__,__LINE__,nnav*sizeof(double),(void **)&ntime,&error);
@@ -1635,8 +1743,10 @@ and mbedit edit save files.\n";
 		}
 
 	    /* read the data points in the nav file */
-	    nnav = 0;
-	    if ((tfp = fopen(process.mbp_navfile, "r")) == NULL)
+	    if (cached == MB_NO)
+		nnav = 0;
+	    if (cached == MB_NO
+		&& (tfp = fopen(process.mbp_navfile, "r")) == NULL)
 		{
 		error = MB_ERROR_OPEN_FAIL;
 		fprintf(stderr,"\nUnable to Open navigation File <%s> for reading\n",process.mbp_navfile);
@@ -1644,7 +1754,8 @@ and mbedit edit save files.\n";
 			program_name);
 		exit(error);
 		}
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
+	    while (cached == MB_NO
+		&& (result = fgets(buffer,nchar,tfp)) == buffer)
 		{
 		nav_ok = MB_NO;
 
@@ -2019,7 +2130,24 @@ and mbedit edit save files.\n";
 			}
 		strncpy(buffer,"\0",sizeof(buffer));
 		}
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		fclose(tfp);
+
+		/* save the parsed nav for later runs */
+		if (nnav > 1)
+		    {
+		    for (i=0;i<9;i++)
+			cachevalues[i] = *cachecolumns[i];
+		    cacheinfo = (process.mbp_nav_heading == MBP_NAV_ON)
+				+ 2 * (process.mbp_nav_speed == MBP_NAV_ON)
+				+ 4 * (process.mbp_nav_draft == MBP_NAV_ON)
+				+ 8 * (process.mbp_nav_attitude == MBP_NAV_ON);
+		    mb_pr_writecache(verbose, process.mbp_navfile, cachekey,
+				9, nnav, cachevalues, cacheinfo, &error);
+		    error = MB_ERROR_NO_ERROR;
+		    }
+		}
 
 
 	    /* check for nav */
@@ -2070,23 +2198,60 @@ and mbedit edit save files.\n";
 	    /* set max number of characters to be read at a time */
 	    nchar = 128;
 
+	    /* use the binary cache of an earlier parse of the adjusted nav file
+		if it is current - the parse depends on lonflip and on whether
+		the depth offsets are required */
+	    cachekey = MBP_CACHE_KEY_NAVADJ + process.mbp_navadj_mode
+			+ 100 * (lonflip + 1);
+	    cachecolumns[0] = &natime;
+	    cachecolumns[1] = &nalon;
+	    cachecolumns[2] = &nalat;
+	    cachecolumns[3] = &naz;
+	    if (mb_pr_readcache(verbose, process.mbp_navadjfile, cachekey,
+			4, &nanav, cachecolumns, &cacheinfo, &error) == MB_SUCCESS)
+		cached = MB_YES;
+	    else
+		cached = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
 	    /* count the data points in the adjusted nav file */
-	    nanav = 0;
-	    if ((tfp = fopen(process.mbp_navadjfile, "r")) == NULL)
+	    if (cached == MB_NO)
+		{
+		nanav = 0;
+		if ((tfp = fopen(process.mbp_navadjfile, "r")) == NULL)
+			{
+			error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to Open Adjusted Navigation File <%s> for reading\n",process.mbp_navadjfile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		while ((result = fgets(buffer,nchar,tfp)) == buffer)
+			if (buffer[0] != '#')
+				nanav++;
+		fclose(tfp);
+		}
+
+	    /* allocate spline arrays for cached adjusted nav */
+	    if (cached == MB_YES)
+		{
+		status = mb_mallocd(verbose,__FILE__,__LINE__,nanav*sizeof(double),(void **)&nalonspl,&error);
+		status = mb_mallocd(verbose,__FILE__,__LINE__,nanav*sizeof(double),(void **)&nalatspl,&error);
+		status = mb_mallocd(verbose,__FILE__,__LINE__,nanav*sizeof(double),(void **)&nazspl,&error);
+
+		/* if error initializing memory then quit */
+		if (error != MB_ERROR_NO_ERROR)
 		    {
-		    error = MB_ERROR_OPEN_FAIL;
-		    fprintf(stderr,"\nUnable to Open Adjusted Navigation File <%s> for reading\n",process.mbp_navadjfile);
+		    mb_error(verbose,error,&message);
+		    fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",message);
 		    fprintf(stderr,"\nProgram <%s> Terminated\n",
 			    program_name);
 		    exit(error);
 		    }
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
-		    if (buffer[0] != '#')
-		    	nanav++;
-	    fclose(tfp);
+		}
 
 	    /* allocate arrays for adjusted nav */
-	    if (nanav > 1)
+	    else if (nanav > 1)
 		{
 		size = (nanav+1)*sizeof(double);
 		status = mb_mallocd(verbose,__FILE__,__LINE__,nanav*sizeof(double),(void **)&natime,&error);
@@ -2119,8 +2284,10 @@ and mbedit edit save files.\n";
 		}
 
 	    /* read the data points in the nav file */
-	    nanav = 0;
-	    if ((tfp = fopen(process.mbp_navadjfile, "r")) == NULL)
+	    if (cached == MB_NO)
+		nanav = 0;
+	    if (cached == MB_NO
+		&& (tfp = fopen(process.mbp_navadjfile, "r")) == NULL)
 		{
 		error = MB_ERROR_OPEN_FAIL;
 		fprintf(stderr,"\nUnable to Open navigation File <%s> for reading\n",process.mbp_navadjfile);
@@ -2128,7 +2295,8 @@ and mbedit edit save files.\n";
 			program_name);
 		exit(error);
 		}
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
+	    while (cached == MB_NO
+		&& (result = fgets(buffer,nchar,tfp)) == buffer)
 		{
 		nav_ok = MB_NO;
 
@@ -2196,7 +2364,20 @@ and mbedit edit save files.\n";
 			}
 		strncpy(buffer,"\0",sizeof(buffer));
 		}
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		fclose(tfp);
+
+		/* save the parsed adjusted nav for later runs */
+		if (nanav > 1)
+		    {
+		    for (i=0;i<4;i++)
+			cachevalues[i] = *cachecolumns[i];
+		    mb_pr_writecache(verbose, process.mbp_navadjfile, cachekey,
+				4, nanav, cachevalues, 0, &error);
+		    error = MB_ERROR_NO_ERROR;
+		    }
+		}
 
 	    /* check for adjusted nav */
 	    if (nanav < 2)
@@ -2243,22 +2424,38 @@ and mbedit edit save files.\n";
 	    /* set max number of characters to be read at a time */
 	    nchar = 128;
 
+	    /* use the binary cache of an earlier parse of the attitude file if it is current */
+	    cachekey = MBP_CACHE_KEY_ATTITUDE + process.mbp_attitude_format;
+	    cachecolumns[0] = &attitudetime;
+	    cachecolumns[1] = &attituderoll;
+	    cachecolumns[2] = &attitudepitch;
+	    cachecolumns[3] = &attitudeheave;
+	    if (mb_pr_readcache(verbose, process.mbp_attitudefile, cachekey,
+			4, &nattitude, cachecolumns, &cacheinfo, &error) == MB_SUCCESS)
+		cached = MB_YES;
+	    else
+		cached = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
 	    /* count the data points in the attitude file */
-	    nattitude = 0;
-	    if ((tfp = fopen(process.mbp_attitudefile, "r")) == NULL)
-		    {
-		    error = MB_ERROR_OPEN_FAIL;
-		    fprintf(stderr,"\nUnable to Open Attitude File <%s> for reading\n",process.mbp_attitudefile);
-		    fprintf(stderr,"\nProgram <%s> Terminated\n",
-			    program_name);
-		    exit(error);
-		    }
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
-		    nattitude++;
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		nattitude = 0;
+		if ((tfp = fopen(process.mbp_attitudefile, "r")) == NULL)
+			{
+			error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to Open Attitude File <%s> for reading\n",process.mbp_attitudefile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		while ((result = fgets(buffer,nchar,tfp)) == buffer)
+			nattitude++;
+		fclose(tfp);
+		}
 
-	    /* allocate arrays for attitude */
-	    if (nattitude > 1)
+	    /* allocate arrays for attitude unless already read from the cache */
+	    if (cached == MB_NO && nattitude > 1)
 		{
 		size = (nattitude+1)*sizeof(double);
 		status = mb_mallocd(verbose,__FILE__,__LINE__,nattitude*sizeof(double),(void **)&attitudetime,&error);
@@ -2278,7 +2475,7 @@ and mbedit edit save files.\n";
 		}
 
 	    /* if no attitude data then quit */
-	    else
+	    else if (cached == MB_NO)
 		{
 		error = MB_ERROR_BAD_DATA;
 		fprintf(stderr,"\nUnable to read data from attitude file <%s>\n",process.mbp_attitudefile);
@@ -2288,8 +2485,10 @@ and mbedit edit save files.\n";
 		}
 
 	    /* read the data points in the attitude file */
-	    nattitude = 0;
-	    if ((tfp = fopen(process.mbp_attitudefile, "r")) == NULL)
+	    if (cached == MB_NO)
+		nattitude = 0;
+	    if (cached == MB_NO
+		&& (tfp = fopen(process.mbp_attitudefile, "r")) == NULL)
 		{
 		error = MB_ERROR_OPEN_FAIL;
 		fprintf(stderr,"\nUnable to Open Attitude File <%s> for reading\n",process.mbp_attitudefile);
@@ -2297,7 +2496,8 @@ and mbedit edit save files.\n";
 			program_name);
 		exit(error);
 		}
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
+	    while (cached == MB_NO
+		&& (result = fgets(buffer,nchar,tfp)) == buffer)
 		{
 		attitude_ok = MB_NO;
 
@@ -2409,7 +2609,20 @@ and mbedit edit save files.\n";
 			}
 		strncpy(buffer,"\0",sizeof(buffer));
 		}
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		fclose(tfp);
+
+		/* save the parsed attitude for later runs */
+		if (nattitude > 1)
+		    {
+		    for (i=0;i<4;i++)
+			cachevalues[i] = *cachecolumns[i];
+		    mb_pr_writecache(verbose, process.mbp_attitudefile, cachekey,
+				4, nattitude, cachevalues, 0, &error);
+		    error = MB_ERROR_NO_ERROR;
+		    }
+		}
 
 
 	    /* check for attitude */
@@ -2448,22 +2661,36 @@ and mbedit edit save files.\n";
 	    /* set max number of characters to be read at a time */
 	    nchar = 128;
 
+	    /* use the binary cache of an earlier parse of the sonardepth file if it is current */
+	    cachekey = MBP_CACHE_KEY_SONARDEPTH + process.mbp_sonardepth_format;
+	    cachecolumns[0] = &fsonardepthtime;
+	    cachecolumns[1] = &fsonardepth;
+	    if (mb_pr_readcache(verbose, process.mbp_sonardepthfile, cachekey,
+			2, &nsonardepth, cachecolumns, &cacheinfo, &error) == MB_SUCCESS)
+		cached = MB_YES;
+	    else
+		cached = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
 	    /* count the data points in the sonardepth file */
-	    nsonardepth = 0;
-	    if ((tfp = fopen(process.mbp_sonardepthfile, "r")) == NULL)
-		    {
-		    error = MB_ERROR_OPEN_FAIL;
-		    fprintf(stderr,"\nUnable to Open Sonardepth File <%s> for reading\n",process.mbp_sonardepthfile);
-		    fprintf(stderr,"\nProgram <%s> Terminated\n",
-			    program_name);
-		    exit(error);
-		    }
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
-		    nsonardepth++;
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		nsonardepth = 0;
+		if ((tfp = fopen(process.mbp_sonardepthfile, "r")) == NULL)
+			{
+			error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to Open Sonardepth File <%s> for reading\n",process.mbp_sonardepthfile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		while ((result = fgets(buffer,nchar,tfp)) == buffer)
+			nsonardepth++;
+		fclose(tfp);
+		}
 
-	    /* allocate arrays for sonardepth */
-	    if (nsonardepth > 1)
+	    /* allocate arrays for sonardepth unless already read from the cache */
+	    if (cached == MB_NO && nsonardepth > 1)
 		{
 		size = (nsonardepth+1)*sizeof(double);
 		status = mb_mallocd(verbose,__FILE__,__LINE__,nsonardepth*sizeof(double),(void **)&fsonardepthtime,&error);
@@ -2481,7 +2708,7 @@ and mbedit edit save files.\n";
 		}
 
 	    /* if no sonardepth data then quit */
-	    else
+	    else if (cached == MB_NO)
 		{
 		error = MB_ERROR_BAD_DATA;
 		fprintf(stderr,"\nUnable to read data from sonardepth file <%s>\n",process.mbp_sonardepthfile);
@@ -2491,8 +2718,10 @@ and mbedit edit save files.\n";
 		}
 
 	    /* read the data points in the sonardepth file */
-	    nsonardepth = 0;
-	    if ((tfp = fopen(process.mbp_sonardepthfile, "r")) == NULL)
+	    if (cached == MB_NO)
+		nsonardepth = 0;
+	    if (cached == MB_NO
+		&& (tfp = fopen(process.mbp_sonardepthfile, "r")) == NULL)
 		{
 		error = MB_ERROR_OPEN_FAIL;
 		fprintf(stderr,"\nUnable to Open Sonardepth File <%s> for reading\n",process.mbp_sonardepthfile);
@@ -2500,7 +2729,8 @@ and mbedit edit save files.\n";
 			program_name);
 		exit(error);
 		}
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
+	    while (cached == MB_NO
+		&& (result = fgets(buffer,nchar,tfp)) == buffer)
 		{
 		sonardepth_ok = MB_NO;
 
@@ -2600,7 +2830,20 @@ and mbedit edit save files.\n";
 			}
 		strncpy(buffer,"\0",sizeof(buffer));
 		}
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		fclose(tfp);
+
+		/* save the parsed sonardepth for later runs */
+		if (nsonardepth > 1)
+		    {
+		    for (i=0;i<2;i++)
+			cachevalues[i] = *cachecolumns[i];
+		    mb_pr_writecache(verbose, process.mbp_sonardepthfile, cachekey,
+				2, nsonardepth, cachevalues, 0, &error);
+		    error = MB_ERROR_NO_ERROR;
+		    }
+		}
 
 
 	    /* check for sonardepth */
@@ -2639,22 +2882,36 @@ and mbedit edit save files.\n";
 	    /* set max number of characters to be read at a time */
 	    nchar = 128;
 
+	    /* use the binary cache of an earlier parse of the tide file if it is current */
+	    cachekey = MBP_CACHE_KEY_TIDE + process.mbp_tide_format;
+	    cachecolumns[0] = &tidetime;
+	    cachecolumns[1] = &tide;
+	    if (mb_pr_readcache(verbose, process.mbp_tidefile, cachekey,
+			2, &ntide, cachecolumns, &cacheinfo, &error) == MB_SUCCESS)
+		cached = MB_YES;
+	    else
+		cached = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
 	    /* count the data points in the tide file */
-	    ntide = 0;
-	    if ((tfp = fopen(process.mbp_tidefile, "r")) == NULL)
-		    {
-		    error = MB_ERROR_OPEN_FAIL;
-		    fprintf(stderr,"\nUnable to Open Tide File <%s> for reading\n",process.mbp_tidefile);
-		    fprintf(stderr,"\nProgram <%s> Terminated\n",
-			    program_name);
-		    exit(error);
-		    }
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
-		    ntide++;
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		ntide = 0;
+		if ((tfp = fopen(process.mbp_tidefile, "r")) == NULL)
+			{
+			error = MB_ERROR_OPEN_FAIL;
+			fprintf(stderr,"\nUnable to Open Tide File <%s> for reading\n",process.mbp_tidefile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		while ((result = fgets(buffer,nchar,tfp)) == buffer)
+			ntide++;
+		fclose(tfp);
+		}
 
-	    /* allocate arrays for tide */
-	    if (ntide > 1)
+	    /* allocate arrays for tide unless already read from the cache */
+	    if (cached == MB_NO && ntide > 1)
 		{
 		size = (ntide+1)*sizeof(double);
 		status = mb_mallocd(verbose,__FILE__,__LINE__,ntide*sizeof(double),(void **)&tidetime,&error);
@@ -2672,7 +2929,7 @@ and mbedit edit save files.\n";
 		}
 
 	    /* if no tide data then quit */
-	    else
+	    else if (cached == MB_NO)
 		{
 		error = MB_ERROR_BAD_DATA;
 		fprintf(stderr,"\nUnable to read data from tide file <%s>\n",process.mbp_tidefile);
@@ -2682,8 +2939,10 @@ and mbedit edit save files.\n";
 		}
 
 	    /* read the data points in the tide file */
-	    ntide = 0;
-	    if ((tfp = fopen(process.mbp_tidefile, "r")) == NULL)
+	    if (cached == MB_NO)
+		ntide = 0;
+	    if (cached == MB_NO
+		&& (tfp = fopen(process.mbp_tidefile, "r")) == NULL)
 		{
 		error = MB_ERROR_OPEN_FAIL;
 		fprintf(stderr,"\nUnable to Open Tide File <%s> for reading\n",process.mbp_tidefile);
@@ -2691,7 +2950,8 @@ and mbedit edit save files.\n";
 			program_name);
 		exit(error);
 		}
-	    while ((result = fgets(buffer,nchar,tfp)) == buffer)
+	    while (cached == MB_NO
+		&& (result = fgets(buffer,nchar,tfp)) == buffer)
 		{
 		tide_ok = MB_NO;
 
@@ -2789,7 +3049,20 @@ and mbedit edit save files.\n";
 			}
 		strncpy(buffer,"\0",sizeof(buffer));
 		}
-	    fclose(tfp);
+	    if (cached == MB_NO)
+		{
+		fclose(tfp);
+
+		/* save the parsed tide for later runs */
+		if (ntide > 0)
+		    {
+		    for (i=0;i<2;i++)
+			cachevalues[i] = *cachecolumns[i];
+		    mb_pr_writecache(verbose, process.mbp_tidefile, cachekey,
+				2, ntide, cachevalues, 0, &error);
+		    error = MB_ERROR_NO_ERROR;
+		    }
+		}
 
 
 	    /* check for tide */
@@ -3531,16 +3804,53 @@ and mbedit edit save files.\n";
 	  read the input file to get first ssv if necessary
 	  --------------------------------------------*/
 	/* read input file until a surface sound velocity value
-		is obtained, then close and reopen the file
-		this provides the starting surface sound velocity
-		for recalculating the bathymetry */
+		is obtained - this provides the starting surface sound
+		velocity for recalculating the bathymetry. The records
+		read are held in a lookahead buffer and replayed by the
+		processing loop. If the format cannot copy records or
+		the buffer fills before a surface sound velocity is found,
+		then the scan continues and the file is closed and reopened */
+	nlookahead = 0;
+	ilookahead = 0;
 	if (process.mbp_bathrecalc_mode == MBP_BATHRECALC_RAYTRACE
 		&& traveltime == MB_YES
 		&& process.mbp_ssv_mode != MBP_SSV_SET)
 	    {
 	    ssv_start = 0.0;
 	    ssv_prelimpass = MB_YES;
+	    lookahead_ok = MB_YES;
+	    error = MB_ERROR_NO_ERROR;
+
+	    /* the extract functions of some systems interpolate navigation,
+	    	heading, attitude and sonar depth from values buffered by mbio
+		as the file is read - replayed records would be extracted
+		against the buffers of the end of the lookahead, so for these
+		systems the file is closed and reopened instead */
+	    lookahead_format = process.mbp_format;
+	    mb_format_system(verbose,&lookahead_format,&lookahead_system,&error);
+	    if (lookahead_system == MB_SYS_RESON7K
+		|| lookahead_system == MB_SYS_SIMRAD2
+		|| lookahead_system == MB_SYS_SIMRAD3
+		|| lookahead_system == MB_SYS_HYSWEEP
+		|| lookahead_system == MB_SYS_XSE)
+		lookahead_ok = MB_NO;
+	    error = MB_ERROR_NO_ERROR;
+
+	    /* the memory held by the lookahead is also limited */
+	    mb_memory_status(verbose,&lookahead_nalloc,&lookahead_nallocmax,
+	    		&lookahead_overflow,&lookahead_allocstart,&error);
 	    error = MB_ERROR_NO_ERROR;
+	    if (lookahead_ok == MB_YES && lookahead == NULL)
+		{
+		status = mb_mallocd(verbose,__FILE__,__LINE__,
+				MBPROCESS_LOOKAHEAD_MAX*sizeof(struct mbprocess_lookahead_struct),
+				(void **)&lookahead,&error);
+		if (status == MB_SUCCESS)
+			memset(lookahead,0,MBPROCESS_LOOKAHEAD_MAX*sizeof(struct mbprocess_lookahead_struct));
+		else
+			lookahead_ok = MB_NO;
+		error = MB_ERROR_NO_ERROR;
+		}
 	    while (error <= MB_ERROR_NO_ERROR
 		&& ssv_start <= 0.0)
 		{
@@ -3555,6 +3865,101 @@ and mbedit edit save files.\n";
 				beamflag,bath,amp,bathacrosstrack,bathalongtrack,
 				ss,ssacrosstrack,ssalongtrack,
 				comment,&error);
+		lookahead_error = error;
+
+		/* hold a copy of the record for the processing loop */
+		if (lookahead_ok == MB_YES
+			&& nlookahead >= MBPROCESS_LOOKAHEAD_MAX)
+			lookahead_ok = MB_NO;
+		if (lookahead_ok == MB_YES && nlookahead > 0)
+			{
+			mb_memory_status(verbose,&lookahead_nalloc,&lookahead_nallocmax,
+					&lookahead_overflow,&lookahead_allocsize,&error);
+			if (lookahead_overflow == MB_YES
+				|| lookahead_allocsize > lookahead_allocstart + MBPROCESS_LOOKAHEAD_MEMORY)
+				lookahead_ok = MB_NO;
+			error = lookahead_error;
+			}
+		if (lookahead_ok == MB_YES)
+			{
+			ahead = &lookahead[nlookahead];
+			nlookahead++;
+			ahead->status = status;
+			ahead->error = error;
+			ahead->kind = kind;
+			for (i=0;i<7;i++)
+				ahead->time_i[i] = time_i[i];
+			ahead->time_d = time_d;
+			ahead->navlon = navlon;
+			ahead->navlat = navlat;
+			ahead->speed = speed;
+			ahead->heading = heading;
+			ahead->distance = distance;
+			ahead->altitude = altitude;
+			ahead->sonardepth = sonardepth;
+			ahead->nbath = nbath;
+			ahead->namp = namp;
+			ahead->nss = nss;
+			strncpy(ahead->comment,comment,MB_COMMENT_MAXLINE-1);
+			ahead->store_ptr = store_ptr;
+			ahead->store_copy = MB_NO;
+			if (error <= MB_ERROR_NO_ERROR && store_ptr != NULL)
+				{
+				ahead->store_ptr = NULL;
+				if (mb_alloc(verbose,imbio_ptr,&(ahead->store_ptr),&error) == MB_SUCCESS)
+					ahead->store_copy = MB_YES;
+				if (ahead->store_copy == MB_NO
+					|| mb_copyrecord(verbose,imbio_ptr,store_ptr,ahead->store_ptr,&error) != MB_SUCCESS)
+					lookahead_ok = MB_NO;
+				error = lookahead_error;
+				}
+			if (lookahead_ok == MB_YES && nbath > 0)
+				{
+				mb_mallocd(verbose,__FILE__,__LINE__,nbath*sizeof(char),(void **)&(ahead->beamflag),&error);
+				mb_mallocd(verbose,__FILE__,__LINE__,nbath*sizeof(double),(void **)&(ahead->bath),&error);
+				mb_mallocd(verbose,__FILE__,__LINE__,nbath*sizeof(double),(void **)&(ahead->bathacrosstrack),&error);
+				mb_mallocd(verbose,__FILE__,__LINE__,nbath*sizeof(double),(void **)&(ahead->bathalongtrack),&error);
+				}
+			if (lookahead_ok == MB_YES && namp > 0)
+				mb_mallocd(verbose,__FILE__,__LINE__,namp*sizeof(double),(void **)&(ahead->amp),&error);
+			if (lookahead_ok == MB_YES && nss > 0)
+				{
+				mb_mallocd(verbose,__FILE__,__LINE__,nss*sizeof(double),(void **)&(ahead->ss),&error);
+				mb_mallocd(verbose,__FILE__,__LINE__,nss*sizeof(double),(void **)&(ahead->ssacrosstrack),&error);
+				mb_mallocd(verbose,__FILE__,__LINE__,nss*sizeof(double),(void **)&(ahead->ssalongtrack),&error);
+				}
+			if (error != lookahead_error)
+				lookahead_ok = MB_NO;
+			error = lookahead_error;
+			if (lookahead_ok == MB_YES)
+				{
+				for (i=0;i<nbath;i++)
+					{
+					ahead->beamflag[i] = beamflag[i];
+					ahead->bath[i] = bath[i];
+					ahead->bathacrosstrack[i] = bathacrosstrack[i];
+					ahead->bathalongtrack[i] = bathalongtrack[i];
+					}
+				for (i=0;i<namp;i++)
+					ahead->amp[i] = amp[i];
+				for (i=0;i<nss;i++)
+					{
+					ahead->ss[i] = ss[i];
+					ahead->ssacrosstrack[i] = ssacrosstrack[i];
+					ahead->ssalongtrack[i] = ssalongtrack[i];
+					}
+				}
+			}
+
+		/* if the record could not be held then give up on the
+			lookahead and fall back to reopening the file */
+		if (lookahead_ok == MB_NO && nlookahead > 0)
+			{
+			mbprocess_free_lookahead(verbose, imbio_ptr,
+					lookahead, nlookahead, &error);
+			nlookahead = 0;
+			error = lookahead_error;
+			}
 
 		/* time gaps do not matter to mbprocess */
 		if (error == MB_ERROR_TIME_GAP)
@@ -3594,75 +3999,78 @@ and mbedit edit save files.\n";
 			}
 		}
 
-	    /* close and reopen the input file */
-	    status = mb_close(verbose,&imbio_ptr,&error);
-	    if ((status = mb_read_init(
-		verbose,process.mbp_ifile,process.mbp_format,pings,lonflip,bounds,
-		btime_i,etime_i,speedmin,timegap,
-		&imbio_ptr,&btime_d,&etime_d,
-		&beams_bath,&beams_amp,&pixels_ss,&error)) != MB_SUCCESS)
+	    /* close and reopen the input file if the lookahead failed */
+	    if (lookahead_ok == MB_NO)
 		{
-		mb_error(verbose,error,&message);
-		fprintf(stderr,"\nMBIO Error returned from function <mb_read_init>:\n%s\n",message);
-		fprintf(stderr,"\nMultibeam File <%s> not initialized for reading\n",process.mbp_ifile);
-		fprintf(stderr,"\nProgram <%s> Terminated\n",
-			program_name);
-		exit(error);
-		}
+		status = mb_close(verbose,&imbio_ptr,&error);
+		if ((status = mb_read_init(
+			verbose,process.mbp_ifile,process.mbp_format,pings,lonflip,bounds,
+			btime_i,etime_i,speedmin,timegap,
+			&imbio_ptr,&btime_d,&etime_d,
+			&beams_bath,&beams_amp,&pixels_ss,&error)) != MB_SUCCESS)
+			{
+			mb_error(verbose,error,&message);
+			fprintf(stderr,"\nMBIO Error returned from function <mb_read_init>:\n%s\n",message);
+			fprintf(stderr,"\nMultibeam File <%s> not initialized for reading\n",process.mbp_ifile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
 
-	    /* reallocate memory for data arrays */
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(char), (void **)&beamflag, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&bath, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_AMPLITUDE,
-						    sizeof(double), (void **)&amp, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&bathacrosstrack, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&bathalongtrack, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
-						    sizeof(double), (void **)&ss, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
-						    sizeof(double), (void **)&ssacrosstrack, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
-						    sizeof(double), (void **)&ssalongtrack, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&ttimes, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&angles, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&angles_forward, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&angles_null, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&bheave, &error);
-	    if (error == MB_ERROR_NO_ERROR)
-		    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
-						    sizeof(double), (void **)&alongtrack_offset, &error);
-
-	    /* if error initializing memory then quit */
-	    if (error != MB_ERROR_NO_ERROR)
-		    {
-		    mb_error(verbose,error,&message);
-		    fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",message);
-		    fprintf(stderr,"\nProgram <%s> Terminated\n",
-			    program_name);
-		    exit(error);
-		    }
+		/* reallocate memory for data arrays */
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(char), (void **)&beamflag, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&bath, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_AMPLITUDE,
+							    sizeof(double), (void **)&amp, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&bathacrosstrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&bathalongtrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							    sizeof(double), (void **)&ss, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							    sizeof(double), (void **)&ssacrosstrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							    sizeof(double), (void **)&ssalongtrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&ttimes, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&angles, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&angles_forward, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&angles_null, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&bheave, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			    status = mb_register_array(verbose, imbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							    sizeof(double), (void **)&alongtrack_offset, &error);
+
+		/* if error initializing memory then quit */
+		if (error != MB_ERROR_NO_ERROR)
+			    {
+			    mb_error(verbose,error,&message);
+			    fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",message);
+			    fprintf(stderr,"\nProgram <%s> Terminated\n",
+				    program_name);
+			    exit(error);
+			    }
+		}
 	    }
 	if (ssv_start <= 0.0)
 		ssv_start = ssv_default;
@@ -4730,20 +5138,62 @@ and mbedit edit save files.\n";
 	/* read and write */
 	while (error <= MB_ERROR_NO_ERROR)
 		{
+		/* replay records held by the surface sound velocity lookahead */
+		if (ilookahead < nlookahead)
+			{
+			ahead = &lookahead[ilookahead];
+			ilookahead++;
+			store_ptr = ahead->store_ptr;
+			kind = ahead->kind;
+			for (i=0;i<7;i++)
+				time_i[i] = ahead->time_i[i];
+			time_d = ahead->time_d;
+			navlon = ahead->navlon;
+			navlat = ahead->navlat;
+			speed = ahead->speed;
+			heading = ahead->heading;
+			distance = ahead->distance;
+			altitude = ahead->altitude;
+			sonardepth = ahead->sonardepth;
+			nbath = ahead->nbath;
+			namp = ahead->namp;
+			nss = ahead->nss;
+			for (i=0;i<nbath;i++)
+				{
+				beamflag[i] = ahead->beamflag[i];
+				bath[i] = ahead->bath[i];
+				bathacrosstrack[i] = ahead->bathacrosstrack[i];
+				bathalongtrack[i] = ahead->bathalongtrack[i];
+				}
+			for (i=0;i<namp;i++)
+				amp[i] = ahead->amp[i];
+			for (i=0;i<nss;i++)
+				{
+				ss[i] = ahead->ss[i];
+				ssacrosstrack[i] = ahead->ssacrosstrack[i];
+				ssalongtrack[i] = ahead->ssalongtrack[i];
+				}
+			strcpy(comment,ahead->comment);
+			status = ahead->status;
+			error = ahead->error;
+			}
+
 		/* read some data */
-		error = MB_ERROR_NO_ERROR;
-		status = MB_SUCCESS;
-		status = mb_get_all(verbose,imbio_ptr,&store_ptr,&kind,
-				time_i,&time_d,&navlon,&navlat,
-				&speed,&heading,
-				&distance,&altitude,&sonardepth,
-				&nbath,&namp,&nss,
-				beamflag,bath,amp,
-				bathacrosstrack,bathalongtrack,
-				ss,ssacrosstrack,ssalongtrack,
-				comment,&error);
+		else
+			{
+			error = MB_ERROR_NO_ERROR;
+			status = MB_SUCCESS;
+			status = mb_get_all(verbose,imbio_ptr,&store_ptr,&kind,
+					time_i,&time_d,&navlon,&navlat,
+					&speed,&heading,
+					&distance,&altitude,&sonardepth,
+					&nbath,&namp,&nss,
+					beamflag,bath,amp,
+					bathacrosstrack,bathalongtrack,
+					ss,ssacrosstrack,ssalongtrack,
+					comment,&error);
+			}
 
-		
 
 		/* time gaps do not matter to mbprocess */
 		if (error == MB_ERROR_TIME_GAP)
@@ -6723,6 +7173,14 @@ j, i, slopeangle, angle, correction, reference_amp, amp[i]);*/
 	  close files and deallocate memory
 	  --------------------------------------------*/
 
+	/* release records held by the surface sound velocity lookahead */
+	if (nlookahead > 0)
+		{
+		status = mbprocess_free_lookahead(verbose, imbio_ptr,
+						lookahead, nlookahead, &error);
+		nlookahead = 0;
+		}
+
 	/* close the files */
 	status = mb_close(verbose,&imbio_ptr,&error);
 	status = mb_close(verbose,&ombio_ptr,&error);
@@ -6876,6 +7334,10 @@ j, i, slopeangle, angle, correction, reference_amp, amp[i]);*/
 	if (read_datalist == MB_YES)
 		mb_datalist_close(verbose,&datalist,&error);
 
+	/* deallocate the lookahead buffer */
+	if (lookahead != NULL)
+		mb_freed(verbose,__FILE__,__LINE__,(void **)&lookahead,&error);
+
 	/* check memory */
 	if (verbose >= 4)
 		status = mb_memory_list(verbose,&error);
@@ -7247,3 +7709,69 @@ int get_anglecorr(int verbose,
 	return(status);
 }
 /*--------------------------------------------------------------------*/
+int mbprocess_free_lookahead(int verbose, void *mbio_ptr,
+	struct mbprocess_lookahead_struct *lookahead, int nlookahead,
+	int *error)
+{
+	char	*function_name = "mbprocess_free_lookahead";
+	int	status = MB_SUCCESS;
+	struct mbprocess_lookahead_struct *ahead;
+	int	i;
+
+	/* print input debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBPROCESS function <%s> called\n",
+			function_name);
+		fprintf(stderr,"dbg2  Input arguments:\n");
+		fprintf(stderr,"dbg2       verbose:     %d\n",verbose);
+		fprintf(stderr,"dbg2       mbio_ptr:    %p\n",(void *)mbio_ptr);
+		fprintf(stderr,"dbg2       lookahead:   %p\n",(void *)lookahead);
+		fprintf(stderr,"dbg2       nlookahead:  %d\n",nlookahead);
+		}
+
+	/* release the copied stores and arrays of the held records */
+	for (i=0;i<nlookahead;i++)
+		{
+		ahead = &lookahead[i];
+		if (ahead->store_copy == MB_YES && ahead->store_ptr != NULL)
+			mb_deall(verbose, mbio_ptr, &(ahead->store_ptr), error);
+		ahead->store_ptr = NULL;
+		ahead->store_copy = MB_NO;
+		if (ahead->beamflag != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->beamflag),error);
+		if (ahead->bath != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->bath),error);
+		if (ahead->bathacrosstrack != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->bathacrosstrack),error);
+		if (ahead->bathalongtrack != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->bathalongtrack),error);
+		if (ahead->amp != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->amp),error);
+		if (ahead->ss != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->ss),error);
+		if (ahead->ssacrosstrack != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->ssacrosstrack),error);
+		if (ahead->ssalongtrack != NULL)
+			mb_freed(verbose,__FILE__,__LINE__,(void **)&(ahead->ssalongtrack),error);
+		}
+
+	/* assume success */
+	*error = MB_ERROR_NO_ERROR;
+	status = MB_SUCCESS;
+
+	/* print output debug statements */
+	if (verbose >= 2)
+		{
+		fprintf(stderr,"\ndbg2  MBPROCESS function <%s> completed\n",
+			function_name);
+		fprintf(stderr,"dbg2  Return values:\n");
+		fprintf(stderr,"dbg2       error:           %d\n",*error);
+		fprintf(stderr,"dbg2  Return status:\n");
+		fprintf(stderr,"dbg2       status:          %d\n",status);
+		}
+
+	/* return status */
+	return(status);
+}
+/*--------------------------------------------------------------------*/
@@ -177,7 +177,42 @@ int main (int argc, char **argv)
 	int	nestimate = 0;
 	int	nmodel = 0;
 
+	/* MBIO read values */
+	void	*mbio_ptr = NULL;
+	void	*store_ptr = NULL;
+	int	datakind;
+	int	pings;
+	int	lonflip;
+	double	bounds[4];
+	int	btime_i[7];
+	int	etime_i[7];
+	double	btime_d;
+	double	etime_d;
+	double	speedmin;
+	double	timegap;
+	int	beams_bath;
+	int	beams_amp;
+	int	pixels_ss;
+	char	*beamflag = NULL;
+	double	*bath = NULL;
+	double	*amp = NULL;
+	double	*bathacrosstrack = NULL;
+	double	*bathalongtrack = NULL;
+	double	*ss = NULL;
+	double	*ssacrosstrack = NULL;
+	double	*ssalongtrack = NULL;
+	char	comment[MB_COMMENT_MAXLINE];
+	char	*message;
+	int	time_i[7];
+	double	navlon, navlat;
+	double	speed, heading;
+	double	distance, altitude, sonardepth;
+	double	draft, pitch, heave;
+	int	ns;
+	double	sx, sy, sxx, sxy, delta;
+
 	int	nr;
+	int	nr0;
 	double	rollint;
 	int	found;
 	int	nscan;
@@ -185,6 +220,11 @@ int main (int argc, char **argv)
 	int	shellstatus;
 	int	i, j, k, l;
 
+	/* get current default values */
+	status = mb_defaults(verbose,&format,&pings,&lonflip,bounds,
+		btime_i,etime_i,&speedmin,&timegap);
+	format = 0;
+
 	/* set default input */
 	strcpy(swathdata, "datalist.mb-1");
 
@@ -431,28 +471,143 @@ int main (int argc, char **argv)
 		nestimate = 0;
 		nslope = 0;
 		time_d_avg = 0.0;
-		sprintf(cmdfile, "mblist -I%s -F%d -OMAR", swathfile, format);
-		fprintf(stderr,"\nRunning %s...\n",cmdfile);
-		fp = popen(cmdfile, "r");
-		while ((nscan = fscanf(fp, "%lf %lf %lf", &time_d, &slope, &roll)) == 3)
+		/* read the roll and the apparent acrosstrack slope of each
+			ping directly rather than through mblist -OMAR */
+		fprintf(stderr,"\nReading %s...\n",swathfile);
+		if ((status = mb_read_init(
+			verbose,swathfile,format,pings,lonflip,bounds,
+			btime_i,etime_i,speedmin,timegap,
+			&mbio_ptr,&btime_d,&etime_d,
+			&beams_bath,&beams_amp,&pixels_ss,&error)) != MB_SUCCESS)
+			{
+			mb_error(verbose,error,&message);
+			fprintf(stderr,"\nMBIO Error returned from function <mb_read_init>:\n%s\n",message);
+			fprintf(stderr,"\nMultibeam File <%s> not initialized for reading\n",swathfile);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+		beamflag = NULL;
+		bath = NULL;
+		amp = NULL;
+		bathacrosstrack = NULL;
+		bathalongtrack = NULL;
+		ss = NULL;
+		ssacrosstrack = NULL;
+		ssalongtrack = NULL;
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							sizeof(char), (void **)&beamflag, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							sizeof(double), (void **)&bath, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_AMPLITUDE,
+							sizeof(double), (void **)&amp, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							sizeof(double), (void **)&bathacrosstrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_BATHYMETRY,
+							sizeof(double), (void **)&bathalongtrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							sizeof(double), (void **)&ss, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							sizeof(double), (void **)&ssacrosstrack, &error);
+		if (error == MB_ERROR_NO_ERROR)
+			status = mb_register_array(verbose, mbio_ptr, MB_MEM_TYPE_SIDESCAN,
+							sizeof(double), (void **)&ssalongtrack, &error);
+
+		/* if error initializing memory then quit */
+		if (error != MB_ERROR_NO_ERROR)
+			{
+			mb_error(verbose,error,&message);
+			fprintf(stderr,"\nMBIO Error allocating data arrays:\n%s\n",message);
+			fprintf(stderr,"\nProgram <%s> Terminated\n",
+				program_name);
+			exit(error);
+			}
+
+		while (error <= MB_ERROR_NO_ERROR)
 			{
-			if (nslope >= nslope_alloc)
+			/* reset error */
+			error = MB_ERROR_NO_ERROR;
+
+			/* read next data record */
+			status = mb_get_all(verbose,mbio_ptr,&store_ptr,&datakind,
+				time_i,&time_d,&navlon,&navlat,
+				&speed,&heading,
+				&distance,&altitude,&sonardepth,
+				&beams_bath,&beams_amp,&pixels_ss,
+				beamflag,bath,amp,bathacrosstrack,bathalongtrack,
+				ss,ssacrosstrack,ssalongtrack,
+				comment,&error);
+
+			/* time gaps are not a problem here */
+			if (error == MB_ERROR_TIME_GAP)
 				{
-				nslope_alloc += MBRTL_ALLOC_CHUNK;
-				status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_time_d, &error);
-				status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_slope, &error);
-				status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_roll, &error);
+				error = MB_ERROR_NO_ERROR;
+				status = MB_SUCCESS;
 				}
-			if (nslope == 0 || time_d > slope_time_d[nslope-1])
+
+			/* get the roll of survey pings */
+			if (error == MB_ERROR_NO_ERROR
+				&& datakind == MB_DATA_DATA)
+				status = mb_extract_nav(verbose,mbio_ptr,store_ptr,&datakind,
+						time_i,&time_d,&navlon,&navlat,
+						&speed,&heading,&draft,&roll,&pitch,&heave,&error);
+
+			/* get the average acrosstrack slope by a linear fit
+				to the good soundings as in mblist */
+			if (error == MB_ERROR_NO_ERROR
+				&& datakind == MB_DATA_DATA
+				&& beams_bath > 0)
 				{
-				slope_time_d[nslope] = time_d;
-				time_d_avg += time_d;
-				slope_slope[nslope] = roll - slope;
-				slope_roll[nslope] = roll;
-				nslope++;
+				ns = 0;
+				sx = 0.0;
+				sy = 0.0;
+				sxx = 0.0;
+				sxy = 0.0;
+				for (k=0;k<beams_bath;k++)
+				  if (mb_beam_ok(beamflag[k]))
+				    {
+				    sx += bathacrosstrack[k];
+				    sy += bath[k];
+				    sxx += bathacrosstrack[k]
+					*bathacrosstrack[k];
+				    sxy += bathacrosstrack[k]*bath[k];
+				    ns++;
+				    }
+				if (ns > 0)
+				  {
+				  delta = ns*sxx - sx*sx;
+				  slope = RTD * atan((ns*sxy - sx*sy)/delta);
+				  }
+				else
+				  slope = 0.0;
+
+				if (nslope >= nslope_alloc)
+					{
+					nslope_alloc += MBRTL_ALLOC_CHUNK;
+					status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_time_d, &error);
+					status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_slope, &error);
+					status = mb_reallocd(verbose,__FILE__,__LINE__, nslope_alloc * sizeof(double), (void **)&slope_roll, &error);
+					}
+				if (nslope == 0 || time_d > slope_time_d[nslope-1])
+					{
+					slope_time_d[nslope] = time_d;
+					time_d_avg += time_d;
+					slope_slope[nslope] = roll - slope;
+					slope_roll[nslope] = roll;
+					nslope++;
+					}
 				}
 			}
-		pclose(fp);
+		status = mb_close(verbose,&mbio_ptr,&error);
+		error = MB_ERROR_NO_ERROR;
+		status = MB_SUCCESS;
 		nslopetot += nslope;
 		if (nslope > 0)
 			time_d_avg /= nslope;
@@ -503,18 +658,41 @@ int main (int argc, char **argv)
 				}
 			slopemean /= npings;
 
+			/* find the first roll value that can fall in this chunk -
+				the roll times are increasing so a bisection gives
+				the start of both the mean and the lag searches */
+			time_d = slope_time_d[j0] + lagstart;
+			nr0 = 0;
+			l = nroll - 1;
+			while (l - nr0 > 1)
+				{
+				j = (nr0 + l) / 2;
+				if (roll_time_d[j] < time_d)
+					nr0 = j;
+				else
+					l = j;
+				}
+
 			/* get mean roll in this chunk */
 			rollmean = 0.0;
 			nrollmean = 0;
-			for (j = 0; j < nroll; j++)
+			for (j = nr0; j < nroll
+				&& roll_time_d[j] <= slope_time_d[j1] + lagend; j++)
 				{
-				if ((roll_time_d[j] >= slope_time_d[j0] + lagstart)
-					&& (roll_time_d[j] <= slope_time_d[j1] + lagend))
+				if (roll_time_d[j] >= slope_time_d[j0] + lagstart)
 					{
 					rollmean += roll_roll[j];
 					nrollmean++;
 					}
 				}
+
+			/* get slope variance in this chunk - the same for all lags */
+			sumslopesq = 0.0;
+			for (j = j0; j <= j1; j++)
+				{
+				slopeminusmean = (slope_slope[j] - slopemean);
+				sumslopesq += slopeminusmean * slopeminusmean;
+				}
 			if (nrollmean > 0)
 				{
 				rollmean /= nrollmean;
@@ -530,23 +708,21 @@ int main (int argc, char **argv)
 					{
 					timelag = lagstart + k * lagstep;
 					sumsloperoll = 0.0;
-					sumslopesq = 0.0;
 					sumrollsq = 0.0;
-					nr = 0;
+					nr = nr0;
 
 					for (j = j0; j <= j1; j++)
 						{
-						/* interpolate lagged roll value */
+						/* interpolate lagged roll value - the lagged
+							times increase with j so the bracketing
+							interval only moves forward */
 						found = MB_NO;
 						time_d = slope_time_d[j] + timelag;
-						for (l = nr; l < nroll - 1 && found == MB_NO; l++)
+						for (l = nr; l < nroll - 1 && roll_time_d[l+1] < time_d; l++);
+						if (l < nroll - 1 && time_d >= roll_time_d[l])
 							{
-							if (time_d >= roll_time_d[l]
-								&& time_d <= roll_time_d[l+1])
-								{
-								nr = l;
-								found = MB_YES;
-								}
+							nr = l;
+							found = MB_YES;
 							}
 						if (found == MB_NO && time_d < roll_time_d[0])
 							{
@@ -566,7 +742,6 @@ int main (int argc, char **argv)
 						/* add to sums */
 						slopeminusmean = (slope_slope[j] - slopemean);
 						rollminusmean = (rollint - rollmean);
-						sumslopesq += slopeminusmean * slopeminusmean;
 						sumrollsq += rollminusmean * rollminusmean;
 						sumsloperoll += slopeminusmean * rollminusmean;
 						}
@@ -196,6 +196,7 @@ int main (int argc, char **argv)
 
 	int	nread;
 	int	tracecount, tracenum, channum, traceok;
+	int	report;
 	double	tracemin, tracemax;
 	double	xwidth, ywidth;
 	int	ix, iy, iys, igainstart, igainend;
@@ -623,9 +624,10 @@ int main (int argc, char **argv)
 			/* reset error */
 			error = MB_ERROR_NO_ERROR;
 
-			/* read a trace */
-			status = mb_segy_read_trace(verbose, mbsegyioptr,
-					&traceheader, &trace, &error);
+			/* read a trace header - the trace data are only read
+				below for traces that will be used or reported */
+			status = mb_segy_read_traceheader(verbose, mbsegyioptr,
+					&traceheader, &error);
 
 			/* now process the trace */
 			if (status == MB_SUCCESS)
@@ -746,17 +748,33 @@ int main (int argc, char **argv)
 					}
 				iys = (btime - timedelay) / sampleinterval;
 
-				/* get trace min and max */
-				tracemin = trace[0];
-				tracemax = trace[0];
-				for (i=0;i<traceheader.nsamps;i++)
+				/* read the trace data if needed */
+				if ((verbose == 0 && nread % 250 == 0) || (nread % 25 == 0))
+					report = MB_YES;
+				else
+					report = MB_NO;
+				if (traceok == MB_YES || report == MB_YES)
 					{
-					tracemin = MIN(tracemin, trace[i]);
-					tracemax = MAX(tracemin, trace[i]);
+					status = mb_segy_read_trace(verbose, mbsegyioptr,
+							&traceheader, &trace, &error);
+					if (status == MB_FAILURE)
+						{
+						traceok = MB_NO;
+						report = MB_NO;
+						}
 					}
 
-				if ((verbose == 0 && nread % 250 == 0) || (nread % 25 == 0))
+				if (report == MB_YES)
 					{
+					/* get trace min and max */
+					tracemin = trace[0];
+					tracemax = trace[0];
+					for (i=0;i<traceheader.nsamps;i++)
+						{
+						tracemin = MIN(tracemin, trace[i]);
+						tracemax = MAX(tracemin, trace[i]);
+						}
+
 					if (traceok == MB_YES)
 						fprintf(outfp,"PROCESS ");
 					else
@@ -95,7 +95,6 @@ int main (int argc, char **argv)
 	struct mb_segyasciiheader_struct asciiheader;
 	struct mb_segyfileheader_struct fileheader;
 	struct mb_segytraceheader_struct traceheader;
-	float	*trace;
 
 	/* output format list controls */
 	char	list[MAX_OPTIONS];
@@ -307,9 +306,9 @@ int main (int argc, char **argv)
 		/* reset error */
 		error = MB_ERROR_NO_ERROR;
 
-		/* read a trace */
-		status = mb_segy_read_trace(verbose, mbsegyioptr,
-				&traceheader, &trace, &error);
+		/* read a trace header - the trace data are not needed */
+		status = mb_segy_read_traceheader(verbose, mbsegyioptr,
+				&traceheader, &error);
 /*fprintf(stderr,"file:%s record:%d shot:%d  %4.4d/%3.3d %2.2d:%2.2d:%2.2d.%3.3d samples:%d interval:%d\n",
 	file,nread,traceheader.shot_num,
 	traceheader.year,traceheader.day_of_yr,
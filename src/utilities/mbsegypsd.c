@@ -112,7 +112,7 @@ int main (int argc, char **argv)
 	/* fft controls */
 	int		nfft = 1024;
 	fftw_plan 	plan;
-	fftw_complex	*fftw_in = NULL;
+	double		*fftw_in = NULL;
 	fftw_complex	*fftw_out = NULL;
 	int		nsection;
 
@@ -165,12 +165,15 @@ int main (int argc, char **argv)
 
 	double	soundpressurelevel;
 
-	double	sint, taper;
+	double	sint;
+	double	*taper = NULL;
+	int	ntaper;
 	double	norm, normraw, normtaper, normfft;
 
 	FILE	*fp;
 	int	nread;
 	int	tracecount, tracenum, channum, traceok;
+	int	report;
 	double	tracemin, tracemax;
 	double	xwidth, ywidth;
 	int	ix, iy, iys;
@@ -485,10 +488,15 @@ int main (int argc, char **argv)
 		for (i=0;i<ngridxy;i++)
 			grid[i] = NaN;
 
-		/* generate the fftw plan */
-		fftw_in = (fftw_complex *) fftw_malloc(sizeof(fftw_complex) * nfft);
-		fftw_out = (fftw_complex *) fftw_malloc(sizeof(fftw_complex) * nfft);
-		plan = fftw_plan_dft_1d(nfft, fftw_in, fftw_out, FFTW_FORWARD, FFTW_MEASURE);
+		/* generate the fftw plan - the input is real so only the
+			nfft/2+1 nonredundant outputs are computed */
+		fftw_in = (double *) fftw_malloc(sizeof(double) * nfft);
+		fftw_out = (fftw_complex *) fftw_malloc(sizeof(fftw_complex) * (nfft / 2 + 1));
+		plan = fftw_plan_dft_r2c_1d(nfft, fftw_in, fftw_out, FFTW_MEASURE);
+
+		/* allocate the taper, which is only recalculated when the section length changes */
+		status = mb_mallocd(verbose,__FILE__,__LINE__, (nfft + 1) * sizeof(double), (void **)&taper, &error);
+		ntaper = -1;
 
 		/* read and print data */
 		nread = 0;
@@ -497,9 +505,10 @@ int main (int argc, char **argv)
 			/* reset error */
 			error = MB_ERROR_NO_ERROR;
 
-			/* read a trace */
-			status = mb_segy_read_trace(verbose, mbsegyioptr,
-					&traceheader, &trace, &error);
+			/* read a trace header - the trace data are only read
+				below for traces that will be used or reported */
+			status = mb_segy_read_traceheader(verbose, mbsegyioptr,
+					&traceheader, &error);
 
 			/* now process the trace */
 			if (status == MB_SUCCESS)
@@ -571,17 +580,33 @@ int main (int argc, char **argv)
 				else if (tracecount % decimatex != 0)
 					traceok = MB_NO;
 
-				/* get trace min and max */
-				tracemin = trace[0];
-				tracemax = trace[0];
-				for (i=0;i<traceheader.nsamps;i++)
+				/* read the trace data if needed */
+				if ((verbose == 0 && nread % 250 == 0) || (nread % 25 == 0))
+					report = MB_YES;
+				else
+					report = MB_NO;
+				if (traceok == MB_YES || report == MB_YES)
 					{
-					tracemin = MIN(tracemin, trace[i]);
-					tracemax = MAX(tracemin, trace[i]);
+					status = mb_segy_read_trace(verbose, mbsegyioptr,
+							&traceheader, &trace, &error);
+					if (status == MB_FAILURE)
+						{
+						traceok = MB_NO;
+						report = MB_NO;
+						}
 					}
 
-				if ((verbose == 0 && nread % 250 == 0) || (nread % 25 == 0))
+				if (report == MB_YES)
 					{
+					/* get trace min and max */
+					tracemin = trace[0];
+					tracemax = trace[0];
+					for (i=0;i<traceheader.nsamps;i++)
+						{
+						tracemin = MIN(tracemin, trace[i]);
+						tracemax = MAX(tracemin, trace[i]);
+						}
+
 					if (traceok == MB_YES)
 						fprintf(outfp,"PROCESS ");
 					else
@@ -637,24 +662,30 @@ int main (int argc, char **argv)
 						/* extract data section to be fft'd with taper */
 						kstart = itstart + j * nfft;
 						kend = MIN(kstart + nfft, itend);
+						if (kend - kstart != ntaper)
+							{
+							ntaper = kend - kstart;
+							for (i=0;i<=ntaper&&i<=nfft;i++)
+								{
+								sint = sin(M_PI * ((double)i) / ((double)ntaper));
+								taper[i] = sint * sint;
+								}
+							}
 						for (i=0;i<nfft;i++)
 							{
 							k = itstart + j * nfft + i;
 							if (k <= kend)
 								{
-								sint = sin(M_PI * ((double)(k - kstart)) / ((double)(kend - kstart)));
-								taper = sint * sint;
-								fftw_in[i][0] = taper * trace[k];
+								fftw_in[i] = taper[i] * trace[k];
 								normraw += trace[k] * trace[k];
-								normtaper += fftw_in[i][0] * fftw_in[i][0];
+								normtaper += fftw_in[i] * fftw_in[i];
 								}
 							else
-								fftw_in[i][0] = 0.0;
+								fftw_in[i] = 0.0;
 /*if (ix < 500)
-fftw_in[i][0] = sin(2.0 * M_PI * 1000.0 * i * sampleinterval)
+fftw_in[i] = sin(2.0 * M_PI * 1000.0 * i * sampleinterval)
 			+ sin(2.0 * M_PI * 3000.0 * i * sampleinterval)
 			+ sin(2.0 * M_PI * 6000.0 * i * sampleinterval);*/
-							fftw_in[i][1] = 0.0;
 							}
 						soundpressurelevel = 20.0 * log10(normraw / nfft);
 /*fprintf(stderr,"Sound Pressure Level: %f dB re 1 uPa\n",soundpressurelevel);*/
@@ -662,15 +693,20 @@ fftw_in[i][0] = sin(2.0 * M_PI * 1000.0 * i * sampleinterval)
 						/* execute the fft */
 						fftw_execute(plan);
 
-						/* get normalization factor - require variance of transform to equal variance of input */
-						for (i=1;i<nfft;i++)
+						/* get normalization factor - require variance of transform to equal variance of input,
+							the outputs above nfft/2 being the complex conjugates of those below */
+						for (i=1;i<(nfft+1)/2;i++)
+							{
+							normfft += 2.0 * (fftw_out[i][0] * fftw_out[i][0] + fftw_out[i][1] * fftw_out[i][1]);
+							}
+						if (nfft % 2 == 0)
 							{
-							normfft += fftw_out[i][0] * fftw_out[i][0] + fftw_out[i][1] * fftw_out[i][1];
+							normfft += fftw_out[nfft/2][0] * fftw_out[nfft/2][0] + fftw_out[nfft/2][1] * fftw_out[nfft/2][1];
 							}
 						norm = normraw / normfft;
 
 						/* apply normalization factor */
-						for (i=1;i<nfft;i++)
+						for (i=1;i<=nfft/2;i++)
 							{
 							fftw_out[i][0] = norm * fftw_out[i][0];
 							fftw_out[i][1] = norm * fftw_out[i][1];
@@ -729,6 +765,7 @@ ix,iy,k,spsd[iy],wpsd[iy],ymax * iy / ngridy,grid[k]);*/
 		fftw_destroy_plan(plan);
 		fftw_free(fftw_in);
 		fftw_free(fftw_out);
+		status = mb_freed(verbose,__FILE__,__LINE__,(void **)&taper, &error);
 		}
 
 	/* write out the grid */
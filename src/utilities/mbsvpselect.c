@@ -34,8 +34,9 @@
  *
  * After finding the appropriate svp for each profile based on the choosed
  * method, the results are copied to a txt file that shows each survey
- * profile with the corresponding SVP. the tool also calls mbset automatically
- * so no need to assign SVP to the data. it is done automatically.
+ * profile with the corresponding SVP. the tool also sets the SVP in the
+ * parameter file of each survey profile, as mbset would, so no need to
+ * assign SVP to the data. it is done automatically.
  *
  * There are 5 methods for choosing the appropriate SVP for each survey
  * profile. These methods are:
@@ -173,7 +174,7 @@
  * Here the -P2/50 option specifies that the sound speed model to be
  * used for each file will be the closest one collected within 50 hours
  * of the swath data. The bathymetry recalculation will be turned on
- * using an mbset call of the form:
+ * for each file just as with an mbset call of the form:
  *
  *      mbset -Idatalist.mb-1 -PSVPFILE:/MyMac/User/Survey_1/SVP_folder/svp1.svp
  *
@@ -195,6 +196,7 @@
 
 #include "mb_define.h"
 #include "mb_status.h"
+#include "mb_process.h"
 
 #include "geodesic.h"
 
@@ -241,6 +243,7 @@ void fill_struct_svp(svp *svp_hold, char *holder);
 void read_list(char *list, char *list_2);
 void trim_newline(char string[]);
 void pause_screen();
+void set_svpfile(char *file, char *svpfile);
 double convert_decimal(int deg, int min, int sec);
 void print_inf(inf *cd);
 void print_svp(svp *cd);
@@ -995,14 +998,14 @@ void read_list
 	FILE *sdHold_file;
 	inf *inf_hold = NULL;
 	svp *svp_hold = NULL;
-	double dist[size][size_2];
-	double time_hold[size][size_2];
-	double hour_hold[size][size_2];
-	double min_hold[size][size_2];
-	double day_hold[size][size_2];
-	/* double dist_time[size][size_2]; */
-	double min_time[size];
-	double min_dis[size];
+	/* distances and time differences from the current file to each svp */
+	double *dist = NULL;
+	double *time_hold = NULL;
+	double *hour_hold = NULL;
+	double *min_hold = NULL;
+	double *day_hold = NULL;
+	double min_time;
+	double min_dis;
 	/* double max_dist[size]; */
 	int n = 0;
 	struct geod_geodesic g;
@@ -1173,6 +1176,20 @@ void read_list
 			print_svp(&svp_hold[i]);
 		}
 
+	/* Allocate memory for the distances and time differences, which
+	 * only need to be held for one file at a time */
+	dist = malloc((size_2)*sizeof(double));
+	time_hold = malloc((size_2)*sizeof(double));
+	hour_hold = malloc((size_2)*sizeof(double));
+	min_hold = malloc((size_2)*sizeof(double));
+	day_hold = malloc((size_2)*sizeof(double));
+	if(dist==NULL || time_hold==NULL || hour_hold==NULL
+		|| min_hold==NULL || day_hold==NULL)
+		{
+		printf("no memory for the process end of process");
+		exit(1);
+		}
+
 	/* calculating the distances and choose the appropriate file */
 	if(p_flag==0)
 		printf("\n Method chosen is %d nearest in position\n", p_flag);
@@ -1222,19 +1239,20 @@ void read_list
 						inf_hold[i].ave_lon,
 						svp_hold[j].s_lat,
 						svp_hold[j].s_lon,
-						&dist[i][j],
+						&dist[j],
 						&azi1,
 						&azi2);
 					if (verbose==1)
-						printf("Distance number %d is : %lf\n", j, dist[i][j]);
+						printf("Distance number %d is : %lf\n", j, dist[j]);
 					}
 				if (verbose==1)
 					printf("\nSearching for the SVP with nearest position\n");
-				min_dis[i] = dist[i][0];
+				min_dis = dist[0];
+				n = 0;
 				for(j=0; j<size_2; j++)
-					if(min_dis[i]>dist[i][j])
+					if(min_dis>dist[j])
 						{
-						min_dis[i] = dist[i][j];
+						min_dis = dist[j];
 						n=j;
 						}
 				if (verbose==1)
@@ -1250,7 +1268,7 @@ void read_list
 				fprintf(fresult,
 					"%s\n",
 					"=============================================================");
-				printf("Calling mbset\n");
+				printf("Setting the parameters as with:\n");
 				/* printf("%s\n", all_in_sys); */
 				strcat(all_in_sys, " -I ");
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1262,7 +1280,7 @@ void read_list
 				strcat(all_in_sys, " -PSVPFILE:");
 				strcat(all_in_sys, svp_hold[n].file_name);
 				printf("%s\n", all_in_sys);
-				system(all_in_sys);
+				set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 				break;
 			case 1:
 				if (verbose==1)
@@ -1280,22 +1298,23 @@ void read_list
 						inf_hold[i].s_lon,
 						svp_hold[j].s_lat,
 						svp_hold[j].s_lon,
-						&dist[i][j],
+						&dist[j],
 						&azi1,
 						&azi2);
 					if (verbose==1)
-						printf("Distance number %d is : %lf\n", j, dist[i][j]);
+						printf("Distance number %d is : %lf\n", j, dist[j]);
 					}
 
 				if (verbose==1)
 					printf("\nSearching for the SVP with the nearest position\n");
 
-				min_dis[i] = dist[i][0];
+				min_dis = dist[0];
+				n = 0;
 
 				for(j=0; j<size_2; j++)
-					if(min_dis[i]>dist[i][j])
+					if(min_dis>dist[j])
 						{
-						min_dis[i] = dist[i][j];
+						min_dis = dist[j];
 						n=j;
 						}
 				if (verbose==1)
@@ -1311,7 +1330,7 @@ void read_list
 				fprintf(fresult,
 					"%s\n",
 					"=============================================================");
-				printf("Building the parameters to call mbset\n");
+				printf("Setting the parameters as with:\n");
 				/* printf("%s\n", all_in_sys); */
 				strcat(all_in_sys, " -I ");
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1320,10 +1339,10 @@ void read_list
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
 				strcat(all_in_sys, inf_hold[i].file_name);
 				/* printf("%s\n", all_in_sys); */
-				strcat(all_in_sys, " -P ");
+				strcat(all_in_sys, " -PSVPFILE:");
 				strcat(all_in_sys, svp_hold[n].file_name);
 				printf("%s\n", all_in_sys);
-				system(all_in_sys);
+				set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 				break;
 			case 2:
 				if (verbose==1)
@@ -1341,21 +1360,22 @@ void read_list
 						inf_hold[i].e_lon,
 						svp_hold[j].s_lat,
 						svp_hold[j].s_lon,
-						&dist[i][j],
+						&dist[j],
 						&azi1,
 						&azi2);
 					if (verbose==1)
-						printf("Distance number %d is : %lf\n", j, dist[i][j]);
+						printf("Distance number %d is : %lf\n", j, dist[j]);
 					}
 				if (verbose==1)
 					printf("\nSearching for the SVP with the nearest position\n");
 
-				min_dis[i] = dist[i][0];
+				min_dis = dist[0];
+				n = 0;
 
 				for(j=0; j<size_2; j++)
-					if(min_dis[i]>dist[i][j])
+					if(min_dis>dist[j])
 						{
-						min_dis[i] = dist[i][j];
+						min_dis = dist[j];
 						n=j;
 						}
 				if (verbose==1)
@@ -1367,7 +1387,7 @@ void read_list
 					"============================================================");
 				fprintf(fresult, "%s\t", inf_hold[i].file_name);
 				fprintf(fresult, "%s\n", svp_hold[n].file_name);
-				printf("Building the parameters to call mbset\n");
+				printf("Setting the parameters as with:\n");
 				/* printf("%s\n", all_in_sys); */
 				strcat(all_in_sys, " -I ");
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1376,10 +1396,10 @@ void read_list
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
 				strcat(all_in_sys, inf_hold[i].file_name);
 				/* printf("%s\n", all_in_sys); */
-				strcat(all_in_sys, " -P ");
+				strcat(all_in_sys, " -PSVPFILE:");
 				strcat(all_in_sys, svp_hold[n].file_name);
 				printf("%s\n", all_in_sys);
-				system(all_in_sys);
+				set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 				fprintf(fresult,
 					"%s\n",
 					"=============================================================");
@@ -1415,17 +1435,18 @@ void read_list
 						inf_hold[i].file_name);
 				for(j=0; j<size_2; j++)
 					{
-					time_hold[i][j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
+					time_hold[j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
 					if (verbose==1)
-						printf("Time number %d is : %lf\n", j, time_hold[i][j]);
+						printf("Time number %d is : %lf\n", j, time_hold[j]);
 					}
 				if (verbose==1)
 					printf("\nSearch for the SVP that is the nearest in Time\n");
-				min_time[i] = time_hold[i][0];
+				min_time = time_hold[0];
+				n = 0;
 				for(j=0; j<size_2; j++)
-					if(min_time[i]>time_hold[i][j])
+					if(min_time>time_hold[j])
 						{
-						min_time[i] = time_hold[i][j];
+						min_time = time_hold[j];
 						n=j;
 						}
 				if (verbose==1)
@@ -1441,7 +1462,7 @@ void read_list
 				fprintf(fresult,
 					"%s\n",
 					"=============================================================");
-				printf("Building the parameters to call mbset\n");
+				printf("Setting the parameters as with:\n");
 				/* printf("%s\n", all_in_sys); */
 				strcat(all_in_sys, " -I ");
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1453,7 +1474,7 @@ void read_list
 				strcat(all_in_sys, " -PSVPFILE:");
 				strcat(all_in_sys, svp_hold[n].file_name);
 				printf("%s\n", all_in_sys);
-				system(all_in_sys);
+				set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 				}
 			/************calculate the nearest in position within time***************************/
 			if(p_flag==2)
@@ -1467,48 +1488,49 @@ void read_list
 						inf_hold[i].file_name);
 				for(j=0; j<size_2; j++)
 					{
-					time_hold[i][j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
-					/* dist[i][j] = distVincenty(inf_hold[i].ave_lat, inf_hold[i].ave_lon,
+					time_hold[j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
+					/* dist[j] = distVincenty(inf_hold[i].ave_lat, inf_hold[i].ave_lon,
 					   svp_hold[j].s_lat, svp_hold[j].s_lon); */
 					geod_inverse(&g,
 						inf_hold[i].ave_lat,
 						inf_hold[i].ave_lon,
 						svp_hold[j].s_lat,
 						svp_hold[j].s_lon,
-						&dist[i][j],
+						&dist[j],
 						&azi1,
 						&azi2);
 					if (verbose==1)
-						printf("Time %d is : %lf\n", j, time_hold[i][j]);
+						printf("Time %d is : %lf\n", j, time_hold[j]);
 					if (verbose==1)
-						printf("Dist %d is : %lf\n", j, dist[i][j]);
+						printf("Dist %d is : %lf\n", j, dist[j]);
 					}
-				min_dis[i] = dist[i][0];
+				min_dis = dist[0];
+				n = 0;
 
 				int count;
 				count = 0;
 
 				for(j=0; j<size_2; j++)
-					if(min_dis[i]>dist[i][j])
+					if(min_dis>dist[j])
 						{
-						min_dis[i] = dist[i][j];
+						min_dis = dist[j];
 						n=j;
 						}
 				for(j=0; j<size_2; j++)
 					{
 					int c = 0;
-					c = time_hold[i][j] - (p_3_time*3600);
+					c = time_hold[j] - (p_3_time*3600);
 					if (c <= 0)
 						{
 						if (count == 0)
 							{
-							min_dis[i] = dist[i][j];
+							min_dis = dist[j];
 							n=j;
 							count+=1;
 							}
-						else if (min_dis[i]>dist[i][j])
+						else if (min_dis>dist[j])
 							{
-							min_dis[i] = dist[i][j];
+							min_dis = dist[j];
 							n=j;
 							}
 						}
@@ -1521,7 +1543,7 @@ void read_list
 				fprintf(fresult,
 					"%s\n",
 					"=============================================================");
-				printf("Building the parameters to call mbset\n");
+				printf("Setting the parameters as with:\n");
 				/* printf("%s\n", all_in_sys); */
 				strcat(all_in_sys, " -I ");
 				inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1533,7 +1555,7 @@ void read_list
 				strcat(all_in_sys, " -PSVPFILE:");
 				strcat(all_in_sys, svp_hold[n].file_name);
 				printf("%s\n", all_in_sys);
-				system(all_in_sys);
+				set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 				}
 			if (p_flag==3)
 				{
@@ -1549,53 +1571,54 @@ void read_list
 					printf("\n Calculating the nearest SVP in month (seasonal selection)\n");
 				for(j=0; j<size_2; j++)
 					{
-					day_hold[i][j] = abs(
+					day_hold[j] = abs(
 						inf_hold[i].s_datum_time.tm_yday - svp_hold[j].svp_datum_time.tm_yday);
-					hour_hold[i][j] = abs(
+					hour_hold[j] = abs(
 						inf_hold[i].s_datum_time.tm_hour - svp_hold[j].svp_datum_time.tm_hour);
-					min_hold[i][j] = abs(
+					min_hold[j] = abs(
 						inf_hold[i].s_datum_time.tm_min - svp_hold[j].svp_datum_time.tm_min);
-					time_hold[i][j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
-					/* dist[i][j] = distVincenty(inf_hold[i].ave_lat, inf_hold[i].ave_lon,
+					time_hold[j] = abs(difftime(inf_hold[i].s_Time, svp_hold[j].svp_Time));
+					/* dist[j] = distVincenty(inf_hold[i].ave_lat, inf_hold[i].ave_lon,
 					   svp_hold[j].s_lat, svp_hold[j].s_lon); */
 					geod_inverse(&g,
 						inf_hold[i].ave_lat,
 						inf_hold[i].ave_lon,
 						svp_hold[j].s_lat,
 						svp_hold[j].s_lon,
-						&dist[i][j],
+						&dist[j],
 						&azi1,
 						&azi2);
 					if (verbose==1)
-						printf("Time %d is : %lf\n", j, time_hold[i][j]);
+						printf("Time %d is : %lf\n", j, time_hold[j]);
 					if (verbose==1)
-						printf("distance %d is : %lf\n", j, dist[i][j]);
+						printf("distance %d is : %lf\n", j, dist[j]);
 					}
 				if(p_4_flage == 0)
 					{
-					min_time[i] = time_hold[i][0];
+					min_time = time_hold[0];
+					n = 0;
 					count = 0;
 					for(j=0; j<size_2; j++)
-						if(min_time[i]>time_hold[i][j])
+						if(min_time>time_hold[j])
 							{
-							min_time[i] = time_hold[i][j];
+							min_time = time_hold[j];
 							n=j;
 							}
 					for(j=0; j<size_2; j++)
 						{
 						int c = 0;
-						c = dist[i][j] - p_4_range;
+						c = dist[j] - p_4_range;
 						if (c <= 0)
 							{
 							if (count == 0)
 								{
-								min_time[i] = time_hold[i][j];
+								min_time = time_hold[j];
 								n=j;
 								count+=1;
 								}
-							else if (min_time[i]>time_hold[i][j])
+							else if (min_time>time_hold[j])
 								{
-								min_time[i] = time_hold[i][j];
+								min_time = time_hold[j];
 								n=j;
 								}
 							}
@@ -1608,7 +1631,7 @@ void read_list
 					fprintf(fresult,
 						"%s\n",
 						"=============================================================");
-					printf("Building the parameters to call mbset\n");
+					printf("Setting the parameters as with:\n");
 					/* printf("%s\n", all_in_sys); */
 					strcat(all_in_sys, " -I ");
 					inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1620,32 +1643,33 @@ void read_list
 					strcat(all_in_sys, " -PSVPFILE:");
 					strcat(all_in_sys, svp_hold[n].file_name);
 					printf("%s\n", all_in_sys);
-					system(all_in_sys);
+					set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 					}
 				else
 					{
-					min_time[i] = day_hold[i][0];
+					min_time = day_hold[0];
+					n = 0;
 					count = 0;
 					for(j=0; j<size_2; j++)
 						{
-						if(min_time[i]>day_hold[i][j])
+						if(min_time>day_hold[j])
 							{
-							min_time[i] = day_hold[i][j];
+							min_time = day_hold[j];
 							n=j;
 							}
-						else if(min_time[i]==day_hold[i][j])
+						else if(min_time==day_hold[j])
 							{
-							if (hour_hold[i][n] > hour_hold[i][j])
+							if (hour_hold[n] > hour_hold[j])
 								{
-								min_time[i] = day_hold [i][j];
+								min_time = day_hold [j];
 								n = j;
 								}
 							else
 								{
-								if (hour_hold[i][n] == hour_hold[i][j])
-									if (min_hold[i][n] > min_hold[i][j])
+								if (hour_hold[n] == hour_hold[j])
+									if (min_hold[n] > min_hold[j])
 										{
-										min_time[i] = day_hold [i][j];
+										min_time = day_hold [j];
 										n = j;
 										}
 								}
@@ -1654,18 +1678,18 @@ void read_list
 					for(j=0; j<size_2; j++)
 						{
 						int c = 0;
-						c = dist[i][j] - p_4_range;
+						c = dist[j] - p_4_range;
 						if (c <= 0)
 							{
 							if (count == 0)
 								{
-								min_time[i] = time_hold[i][j];
+								min_time = time_hold[j];
 								n=j;
 								count+=1;
 								}
-							else if (min_time[i]>time_hold[i][j])
+							else if (min_time>time_hold[j])
 								{
-								min_time[i] = time_hold[i][j];
+								min_time = time_hold[j];
 								n=j;
 								}
 							}
@@ -1678,7 +1702,7 @@ void read_list
 					fprintf(fresult,
 						"%s\n",
 						"=============================================================");
-					printf("Building the parameters to call mbset\n");
+					printf("Setting the parameters as with:\n");
 					/* printf("%s\n", all_in_sys); */
 					strcat(all_in_sys, " -I ");
 					inf_hold[i].file_name[strlen(inf_hold[i].file_name)-1]='\0';
@@ -1690,18 +1714,71 @@ void read_list
 					strcat(all_in_sys, " -PSVPFILE:");
 					strcat(all_in_sys, svp_hold[n].file_name);
 					printf("%s\n", all_in_sys);
-					system(all_in_sys);
+					set_svpfile(inf_hold[i].file_name, svp_hold[n].file_name);
 					}
 				}
 			}
 		}
 	free(inf_hold);
 	free(svp_hold);
+	free(dist);
+	free(time_hold);
+	free(hour_hold);
+	free(min_hold);
+	free(day_hold);
 	fclose(fDatalist);
 	fclose(fSvp);
 	fclose(fresult);
 } /* read_list */
 /* ---------------------------------------------------------------- */
+/*
+ *  Function set_svpfile
+ *	Turn on bathymetry recalculation using svpfile in the parameter file
+ *	of the swath file, as "mbset -I file -PSVPFILE:svpfile" would, but
+ *	without running mbset once for each file
+ */
+void set_svpfile
+(
+	char *file,
+	char *svpfile
+)
+{
+	struct mb_process_struct process;
+	int format;
+	int error = MB_ERROR_NO_ERROR;
+	int status = MB_SUCCESS;
+
+	/* load parameters */
+	status = mb_pr_readpar(verbose, file, MB_NO, &process, &error);
+	process.mbp_ifile_specified = MB_YES;
+	if (process.mbp_format_specified == MB_NO)
+		{
+		format = 0;
+		mb_get_format(verbose, file, NULL, &format, &error);
+		process.mbp_format = format;
+		process.mbp_format_specified = MB_YES;
+		}
+	if (process.mbp_ofile_specified == MB_NO)
+		{
+		process.mbp_ofile_specified = MB_YES;
+		mb_pr_default_output(verbose, &process, &error);
+		}
+
+	/* set the svp file and turn on raytracing */
+	strcpy(process.mbp_svpfile, svpfile);
+	process.mbp_svp_mode = MBP_SVP_ON;
+
+	/* update bathymetry recalculation mode */
+	mb_pr_bathmode(verbose, &process, &error);
+
+	/* write parameters */
+	status = mb_pr_writepar(verbose, file, &process, &error);
+	if (status == MB_SUCCESS)
+		printf("Success updating parameter file for %s...\n", file);
+	else
+		printf("Failure to update parameter file for %s!!!\n", file);
+} /* set_svpfile */
+/* ---------------------------------------------------------------- */
 /*
  *  Function trim_newline
  *	Delete the '\n' char from string